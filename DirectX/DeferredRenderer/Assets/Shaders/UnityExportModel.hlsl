@@ -16,7 +16,6 @@ struct VS_INPUT
 	float3 Pos : POSITION;
 	float3 Nor : NORMAL;
 	float2 Tex : TEXCOORD;
-	float4 Col : COLOR;
 };
 
 struct PS_INPUT
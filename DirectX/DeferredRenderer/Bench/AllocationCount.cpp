@@ -0,0 +1,85 @@
+//ǂݍ1񂠂̃q[vmۂ̉񐔂𐔂
+//O[ooperator newuāAǂݍ݂̑Oŉ񐔂̍
+//
+//rh(VisualStudio̊J҃R}hvvgŁADeferredRenderer̃tH_[):
+//	cl /std:c++17 /O2 /EHsc /I Source Bench\AllocationCount.cpp
+//s(DeferredRenderer̃tH_[):
+//	AllocationCount.exe
+#include "UniExportModel.hpp"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<std::size_t> g_allocationCount{ 0 };
+
+void* operator new(std::size_t size)
+{
+	g_allocationCount++;
+	if (void* p = std::malloc(size ? size : 1))
+		return p;
+	throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+	g_allocationCount++;
+	const auto align = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+	if (void* p = _aligned_malloc(size ? size : 1, align))
+		return p;
+#else
+	if (void* p = std::aligned_alloc(align, (size + align - 1) / align * align))
+		return p;
+#endif
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+#ifdef _WIN32
+void operator delete(void* p, std::align_val_t) noexcept { _aligned_free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { _aligned_free(p); }
+#else
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+#endif
+
+//TṽXLbVƓ_CAEg
+struct VertexData
+{
+	DirectX::XMFLOAT3 position;
+	DirectX::XMFLOAT3 normal;
+	DirectX::XMFLOAT2 uv;
+	DirectX::XMUINT4 boneIndex;
+	DirectX::XMFLOAT4 boneWeight;
+};
+
+template <class Func>
+static void Count(const char* name, Func func)
+{
+	const auto start = g_allocationCount.load();
+	func();
+	printf("%-48s %6zu\n", name, g_allocationCount.load() - start);
+}
+
+int main()
+{
+	const std::string dir = "Assets/Models/";
+
+	uem::SkinnedModel<VertexData> model;
+	Count("SkinnedModel::LoadBinary(SkinnedMeshData.usb)", [&]() { model.LoadBinary(dir + "SkinnedMeshData.usb"); });
+	if (!model.m_root)
+	{
+		printf("Assets/Models/SkinnedMeshData.usb not found\n");
+		return 1;
+	}
+	Count("SkinnedModel::LoadAscii(SkinnedMeshData.usa)", [&]() { uem::SkinnedModel<VertexData> ascii; ascii.LoadAscii(dir + "SkinnedMeshData.usa"); });
+
+	for (auto clip : { "JUMP00", "RUN00_F", "SLIDE00" })
+	{
+		const auto name = std::string("SkinnedAnimation::LoadBinary(") + clip + "anim.usab)";
+		Count(name.c_str(), [&]() { uem::SkinnedAnimation animation; animation.LoadBinary(dir + clip + "anim.usab", model.m_root.get()); });
+	}
+	return 0;
+}
@@ -0,0 +1,178 @@
+//Aj[ṼL[̌ɂ鎞Ԃ𑪂
+//EJ[uP: 擪`ɒT@(J[\O̎)AŐԂoĂ@(Curve::GetValue(time, key))A
+//  񕪒T@(Curve::GetValue(time))L[̐Ƃɔׂ
+//ENbvS: ̃NbvƁA10000L[̍NbvSetTransform1t[̎Ԃ𑪂
+//  Nbv̓L[̎ԂSẴgbNő(SoAɂ܂Ƃ߂)ƁAgbNƂɂ炵(gbNƂɕԂ)
+//
+//rh(VisualStudio̊J҃R}hvvgŁADeferredRenderer̃tH_[):
+//	cl /std:c++17 /O2 /EHsc /I Source Bench\KeyframeLookup.cpp
+//s(DeferredRenderer̃tH_[ANbv̓JgtH_[ɈꎞIɏo):
+//	KeyframeLookup.exe
+#include "UniExportModel.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+using Curve = uem::SkinnedAnimation::Curve;
+
+//TṽXLbVƓ_CAEg
+struct VertexData
+{
+	DirectX::XMFLOAT3 position;
+	DirectX::XMFLOAT3 normal;
+	DirectX::XMFLOAT2 uv;
+	DirectX::XMUINT4 boneIndex;
+	DirectX::XMFLOAT4 boneWeight;
+};
+
+static constexpr int FrameCount = 2000;
+static constexpr int RepeatCount = 20;
+
+//Đ(60fpsŐi߂ĖŐ擪ɖ߂)ƃV[N(l̎)̎Ԃ̕
+static std::vector<float> MakeTimes(const float duration, const bool seek)
+{
+	std::vector<float> times(FrameCount);
+	std::mt19937 random(12345);
+	std::uniform_real_distribution<float> distribution(0.0f, duration);
+	for (auto i = 0; i < FrameCount; i++)
+		times[i] = seek ? distribution(random) : std::fmod(i / 60.0f, duration);
+	return times;
+}
+
+//functimes̑SĂ̎ԂŌĂяo(RepeatCount̂ŒZA1񂠂us)
+template <class Func>
+static double Measure(const std::vector<float>& times, Func func)
+{
+	auto best = 1e30;
+	for (auto r = 0; r < RepeatCount; r++)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		for (const auto time : times)
+			func(time);
+		const auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+		best = std::min<double>(best, elapsed / times.size());
+	}
+	return best;
+}
+
+//J[\OCurve::GetValue(擪`ɒT)
+static float ScanValue(const Curve& curve, const float time)
+{
+	const auto& times = curve.times;
+	const auto& keys = curve.keys;
+	if (times.size() == 1 || time < times[0])
+		return keys[0];
+	if (time > times[times.size() - 1])
+		return keys[keys.size() - 1];
+	std::size_t index = 0;
+	while (index < times.size() - 2 && times[index + 1] <= time)
+		index++;
+	const auto s = (time - times[index]) / (times[index + 1] - times[index]);
+	return keys[index] + (keys[index + 1] - keys[index]) * s;
+}
+
+static void BenchmarkCurves()
+{
+	printf("curve lookup (ns per call)          play: scan  cursor  search    seek: scan  cursor  search\n");
+	for (const std::size_t keyCount : { 2, 3, 4, 8, 32, 256, 10000 })
+	{
+		Curve curve;
+		for (std::size_t i = 0; i < keyCount; i++)
+		{
+			curve.times.push_back(i / 30.0f);
+			curve.keys.push_back(std::sin(i * 0.1f));
+		}
+		const auto duration = curve.times.back();
+		volatile float sink = 0;
+		double result[2][3];
+		for (auto seek = 0; seek < 2; seek++)
+		{
+			const auto times = MakeTimes(duration, seek != 0);
+			uint32_t key = 0;
+			result[seek][0] = Measure(times, [&](const float time) { sink = ScanValue(curve, time); });
+			result[seek][1] = Measure(times, [&](const float time) { sink = curve.GetValue(time, key); });
+			result[seek][2] = Measure(times, [&](const float time) { sink = curve.GetValue(time); });
+		}
+		printf("  %5zu keys %29.1f %7.1f %7.1f %11.1f %7.1f %7.1f\n", keyCount,
+			result[0][0] * 1000, result[0][1] * 1000, result[0][2] * 1000, result[1][0] * 1000, result[1][1] * 1000, result[1][2] * 1000);
+	}
+}
+
+//`(.usab)̍Nbvo
+//擪boneCount{̃{[̑SĂ̐keyCount̃L[AjitterȂL[̎ԂgbNƂɂ炷
+static bool WriteSyntheticClip(const std::string& filename, const uem::TransformTable& table, const uint32_t boneCount,
+	const uint32_t keyCount, const bool jitter)
+{
+	FILE* fp = nullptr;
+	if (fopen_s(&fp, filename.c_str(), "wb") != 0 || !fp)
+		return false;
+	fwrite(&boneCount, sizeof(uint32_t), 1, fp);
+	std::vector<float> times(keyCount), keys(keyCount);
+	for (uint32_t bone = 0; bone < boneCount; bone++)
+	{
+		const auto& name = table.Get(bone + 1)->m_name;
+		const auto length = static_cast<uint16_t>(name.size());
+		fwrite(&length, sizeof(uint16_t), 1, fp);
+		fwrite(name.data(), sizeof(char), length, fp);
+		for (auto channel = 0; channel < 10; channel++)
+		{
+			const auto offset = jitter ? (bone * 10 + channel + 1) / 1000.0f / 30.0f : 0.0f;
+			for (uint32_t i = 0; i < keyCount; i++)
+			{
+				times[i] = i / 30.0f + (i > 0 ? offset : 0.0f);
+				//]͒PʃNH[^jI̋߂AXP[1̋߂
+				const auto wave = std::sin(i * 0.05f + bone + channel);
+				keys[i] = channel >= 3 && channel <= 6 ? (channel == 6 ? 1.0f : 0.0f) + 0.01f * wave : channel >= 7 ? 1.0f + 0.01f * wave : wave;
+			}
+			fwrite(&keyCount, sizeof(uint32_t), 1, fp);
+			fwrite(times.data(), sizeof(float), keyCount, fp);
+			fwrite(keys.data(), sizeof(float), keyCount, fp);
+		}
+	}
+	fclose(fp);
+	return true;
+}
+
+static void BenchmarkClip(const char* name, uem::SkinnedAnimation& animation)
+{
+	const auto duration = animation.GetMaxAnimationTime();
+	const auto play = Measure(MakeTimes(duration, false), [&](const float time) { animation.SetTransform(time); });
+	const auto seek = Measure(MakeTimes(duration, true), [&](const float time) { animation.SetTransform(time); });
+	printf("  %-40s %-5s %8.2f %8.2f\n", name, animation.HasPoseSampler() ? "SoA" : "track", play, seek);
+}
+
+int main()
+{
+	BenchmarkCurves();
+
+	const std::string dir = "Assets/Models/";
+	uem::SkinnedModel<VertexData> model;
+	model.LoadBinary(dir + "SkinnedMeshData.usb");
+	if (!model.m_root)
+	{
+		printf("Assets/Models/SkinnedMeshData.usb not found\n");
+		return 1;
+	}
+
+	printf("\nSetTransform (us per frame)                 path      play     seek\n");
+	for (auto clip : { "JUMP00", "RUN00_F", "SLIDE00", "REFLESH00", "HANDUP00_R" })
+	{
+		uem::SkinnedAnimation animation;
+		animation.LoadBinary(dir + clip + "anim.usab", model.m_root.get());
+		BenchmarkClip((std::string(clip) + "anim.usab").c_str(), animation);
+	}
+
+	const uem::TransformTable table(model.m_root.get());
+	for (const auto jitter : { false, true })
+	{
+		const std::string filename = jitter ? "KeyframeLookupJitter.usab" : "KeyframeLookup.usab";
+		if (!WriteSyntheticClip(filename, table, 20, 10000, jitter))
+			return 1;
+		uem::SkinnedAnimation animation;
+		animation.LoadBinary(filename, model.m_root.get());
+		std::remove(filename.c_str());
+		BenchmarkClip(jitter ? "synthetic 20 bones x 10000 keys, jitter" : "synthetic 20 bones x 10000 keys", animation);
+	}
+	return 0;
+}
@@ -517,43 +517,10 @@ bool DirectX11Manager::CreateConstantBuffer(unsigned int bytesize, ID3D11Buffer
 
 ID3D11ShaderResourceView* DirectX11Manager::CreateTextureFromFile(const wchar_t* filename)
 {
-	ID3D11ShaderResourceView* ShaderResView;
-
-	char ms[100];
-	setlocale(LC_CTYPE, "jpn");
-	wcstombs(ms, filename, 100);
-	char* gq = strstr(ms, ".");
-
-	if (gq == NULL)
+	TextureImage textureImage;
+	if (!LoadTextureImage(filename, textureImage))
 		return nullptr;
-
-	if (strcmp(gq, ".tga") == 0 || strcmp(gq, ".TGA") == 0) {
-		TexMetadata meta;
-		GetMetadataFromTGAFile(filename, meta);
-
-		std::unique_ptr<ScratchImage> image(new ScratchImage);
-		HRESULT hr = LoadFromTGAFile(filename, &meta, *image);
-		if (FAILED(hr))
-			return nullptr;
-		hr = CreateShaderResourceView(m_pDevice.Get(), image->GetImages(), image->GetImageCount(), meta, &ShaderResView);
-		if (FAILED(hr))
-			return nullptr;
-		return ShaderResView;
-	}
-	else
-	{
-		TexMetadata meta;
-		GetMetadataFromWICFile(filename, 0, meta);
-
-		std::unique_ptr<ScratchImage> image(new ScratchImage);
-		HRESULT hr = LoadFromWICFile(filename, 0, &meta, *image);
-		if (FAILED(hr))
-			return nullptr;
-		hr = CreateShaderResourceView(m_pDevice.Get(), image->GetImages(), image->GetImageCount(), meta, &ShaderResView);
-		if (FAILED(hr))
-			return nullptr;
-		return ShaderResView;
-	}
+	return CreateTextureFromImage(textureImage);
 }
 ID3D11ShaderResourceView* DirectX11Manager::CreateTextureFromFile(const std::string filename)
 {
@@ -569,6 +536,54 @@ ID3D11ShaderResourceView* DirectX11Manager::CreateTextureFromFile(const char* fi
 	mbstowcs(ws, filename, 512);
 	return CreateTextureFromFile(ws);
 }
+bool DirectX11Manager::LoadTextureImage(const wchar_t* filename, TextureImage& textureImage)
+{
+	const wchar_t* gq = wcsstr(filename, L".");
+
+	if (gq == NULL)
+		return false;
+
+	HRESULT hr;
+	textureImage.image.reset(new ScratchImage);
+	if (wcscmp(gq, L".tga") == 0 || wcscmp(gq, L".TGA") == 0) {
+		GetMetadataFromTGAFile(filename, textureImage.meta);
+		hr = LoadFromTGAFile(filename, &textureImage.meta, *textureImage.image);
+	}
+	else
+	{
+		GetMetadataFromWICFile(filename, 0, textureImage.meta);
+		hr = LoadFromWICFile(filename, 0, &textureImage.meta, *textureImage.image);
+	}
+	if (FAILED(hr)) {
+		textureImage.image.reset();
+		return false;
+	}
+	return true;
+}
+bool DirectX11Manager::LoadTextureImage(const std::string& filename, TextureImage& textureImage)
+{
+	if (filename.empty())
+		return false;
+
+	//setlocale̓vZXŜɉêŃ[J[XbhłSAPIŕϊ
+	wchar_t ws[512];
+	if (MultiByteToWideChar(CP_ACP, 0, filename.c_str(), -1, ws, 512) == 0)
+		return false;
+
+	//WICWinMainŏMTAŎg([J[Xbh͈ÖقMTAɑ)
+	return LoadTextureImage(ws, textureImage);
+}
+ID3D11ShaderResourceView* DirectX11Manager::CreateTextureFromImage(const TextureImage& textureImage)
+{
+	if (!textureImage.image)
+		return nullptr;
+
+	ID3D11ShaderResourceView* ShaderResView;
+	HRESULT hr = CreateShaderResourceView(m_pDevice.Get(), textureImage.image->GetImages(), textureImage.image->GetImageCount(), textureImage.meta, &ShaderResView);
+	if (FAILED(hr))
+		return nullptr;
+	return ShaderResView;
+}
 
 void DirectX11Manager::SetInputLayout(ID3D11InputLayout* VertexLayout)
 {
@@ -587,9 +602,14 @@ void DirectX11Manager::SetVertexBuffer(ID3D11Buffer* VertexBuffer, UINT VertexSi
 	UINT hOffsets = 0;
 	m_pImContext->IASetVertexBuffers(0, 1, &VertexBuffer, &VertexSize, &hOffsets);
 }
-void DirectX11Manager::SetIndexBuffer(ID3D11Buffer* IndexBuffer)
+void DirectX11Manager::SetVertexBuffers(UINT BufferNum, ID3D11Buffer* const* VertexBuffers, const UINT* VertexSizes)
+{
+	UINT hOffsets[D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT] = {};
+	m_pImContext->IASetVertexBuffers(0, BufferNum, VertexBuffers, VertexSizes, hOffsets);
+}
+void DirectX11Manager::SetIndexBuffer(ID3D11Buffer* IndexBuffer, UINT IndexSize)
 {
-	m_pImContext->IASetIndexBuffer(IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+	m_pImContext->IASetIndexBuffer(IndexBuffer, IndexSize == sizeof(uint16_t) ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT, 0);
 }
 
 void DirectX11Manager::SetTexture2D(UINT RegisterNo, ID3D11ShaderResourceView* Texture)
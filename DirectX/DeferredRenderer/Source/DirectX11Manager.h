@@ -22,6 +22,8 @@
 #include <unordered_map>
 #include <utility>
 #include <functional>
+#include <future>
+#include <chrono>
 
 #pragma comment(lib, "d3d11.lib")
 #pragma comment(lib, "d3dcompiler.lib")
@@ -47,6 +49,13 @@ typedef ComPtr<ID3D11Texture2D> Texture2D;
 typedef ComPtr<ID3D11ShaderResourceView> ShaderTexture;
 typedef ComPtr<ID3D11UnorderedAccessView> ComputeOutputView;
 
+//fR[hς݂̃eNX`(GPUւ̓]Õf[^)
+struct TextureImage
+{
+	std::unique_ptr<ScratchImage> image;
+	TexMetadata meta;
+};
+
 class DirectX11Manager
 {
 	HWND hWnd = NULL;
@@ -82,6 +91,27 @@ public:
 
 	//inputlayout쐬
 	ID3D11InputLayout* CreateInputLayout(D3D11_INPUT_ELEMENT_DESC* layout, UINT elem_num, const string& filename, const string& entrypath = "");
+	//_̌^̗vfLq(VertexAttributes)BsplitStreamsȂ璸_Xg[Ƃ̃Xbgɕ
+	template<class x>
+	ID3D11InputLayout* CreateInputLayout(const string& filename, const string& entrypath = "", bool splitStreams = false)
+	{
+		const auto elements = uem::VertexReflection<x>::GetInputElements(splitStreams);
+		std::array<D3D11_INPUT_ELEMENT_DESC, uem::VertexReflection<x>::count> layout;
+		for (size_t i = 0; i < elements.size(); i++)
+		{
+			const auto& e = elements[i];
+			DXGI_FORMAT format = DXGI_FORMAT_R32G32B32A32_FLOAT;
+			switch (e.format)
+			{
+			case uem::VertexElementFormat::FLOAT2: format = DXGI_FORMAT_R32G32_FLOAT; break;
+			case uem::VertexElementFormat::FLOAT3: format = DXGI_FORMAT_R32G32B32_FLOAT; break;
+			case uem::VertexElementFormat::UINT4: format = DXGI_FORMAT_R32G32B32A32_UINT; break;
+			default: break;
+			}
+			layout[i] = { e.semanticName, e.semanticIndex, format, e.slot, e.offset, D3D11_INPUT_PER_VERTEX_DATA, 0 };
+		}
+		return CreateInputLayout(layout.data(), (UINT)layout.size(), filename, entrypath);
+	}
 
 	//RX^gobt@쐬
 	bool CreateConstantBuffer(unsigned int bytesize, ID3D11Buffer** CBuffer);
@@ -94,11 +124,16 @@ public:
 	//bufferCreate
 	template<class x>
 	ID3D11Buffer* CreateVertexBuffer(x* VertexData, UINT VertexNum)
+	{
+		return CreateVertexBuffer(VertexData, VertexNum, sizeof(x));
+	}
+	//VertexSize1_̃oCg(_Xg[̂悤Ɍ^Ȃf[^p)
+	ID3D11Buffer* CreateVertexBuffer(const void* VertexData, UINT VertexNum, UINT VertexSize)
 	{
 		//_obt@쐬
 		D3D11_BUFFER_DESC hBufferDesc;
 		ZeroMemory(&hBufferDesc, sizeof(hBufferDesc));
-		hBufferDesc.ByteWidth = sizeof(x) * VertexNum;
+		hBufferDesc.ByteWidth = VertexSize * VertexNum;
 		hBufferDesc.Usage = D3D11_USAGE_DEFAULT;
 		hBufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
 		hBufferDesc.CPUAccessFlags = 0;
@@ -117,12 +152,13 @@ public:
 		}
 		return hpBuffer;
 	}
-	ID3D11Buffer* CreateIndexBuffer(UINT* Index, UINT IndexNum)
+	//IndexSize1vf̃oCg(2Ȃ16bitA4Ȃ32bit)
+	ID3D11Buffer* CreateIndexBuffer(const void* Index, UINT IndexNum, UINT IndexSize = sizeof(UINT))
 	{
 		//CfbNXobt@쐬
 		D3D11_BUFFER_DESC hBufferDesc;
 		ZeroMemory(&hBufferDesc, sizeof(hBufferDesc));
-		hBufferDesc.ByteWidth = sizeof(UINT) * IndexNum;
+		hBufferDesc.ByteWidth = IndexSize * IndexNum;
 		hBufferDesc.Usage = D3D11_USAGE_DEFAULT;
 		hBufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
 		hBufferDesc.CPUAccessFlags = 0;
@@ -163,6 +199,10 @@ public:
 	ID3D11ShaderResourceView* CreateTextureFromFile(const wchar_t* filename);
 	ID3D11ShaderResourceView* CreateTextureFromFile(const std::string filename);
 	ID3D11ShaderResourceView* CreateTextureFromFile(const char* filename);
+	//t@C̃fR[hs(foCXɐGȂ̂Ń[J[XbhĂׂ)
+	bool LoadTextureImage(const wchar_t* filename, TextureImage& textureImage);
+	bool LoadTextureImage(const std::string& filename, TextureImage& textureImage);
+	ID3D11ShaderResourceView* CreateTextureFromImage(const TextureImage& textureImage);
 
 	//PipelineSetting
 	void SetInputLayout(ID3D11InputLayout* VertexLayout);
@@ -170,7 +210,9 @@ public:
 	void SetPixelShader(ID3D11PixelShader* ps);
 
 	void SetVertexBuffer(ID3D11Buffer* VertexBuffer, UINT VertexSize);
-	void SetIndexBuffer(ID3D11Buffer* IndexBuffer);
+	//Xbg0珇ɕ̒_obt@ݒ肷
+	void SetVertexBuffers(UINT BufferNum, ID3D11Buffer* const* VertexBuffers, const UINT* VertexSizes);
+	void SetIndexBuffer(ID3D11Buffer* IndexBuffer, UINT IndexSize = sizeof(UINT));
 
 	void SetTexture2D(UINT RegisterNo, ID3D11ShaderResourceView* Texture);
 
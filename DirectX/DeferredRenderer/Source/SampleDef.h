@@ -51,13 +51,21 @@ inline Matrix Transpose(const Matrix& matrix)
     return XMMatrixTranspose( matrix );
 }
 
+//OƎq̔zresourcemۂ(f̃A[iɂ܂Ƃ߂邽)
 struct Transform
 {
+    Transform() = default;
+
+    explicit Transform(std::pmr::memory_resource* resource)
+        : m_child( resource ), m_name( resource )
+    {
+    }
+
     Transform* m_parent = nullptr;
-    std::vector<Transform*> m_child;
+    std::pmr::vector<Transform*> m_child;
 
     std::size_t m_hash;
-    std::string m_name;
+    std::pmr::string m_name;
     Float3 m_position;
     Vector4 m_rotation;
     Float3 m_scale;
@@ -74,7 +82,7 @@ struct Transform
 
     Transform* Find(const std::string& str)
     {
-        if ( m_name == str )
+        if ( std::string_view( m_name ) == str )
             return this;
         for ( auto* t : m_child )
         {
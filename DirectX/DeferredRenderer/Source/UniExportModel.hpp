@@ -1,5 +1,6 @@
 #pragma once
 #include <cstring>
+#include <cstddef>
 #include <memory>
 #include <cstdio>
 #include <fstream>
@@ -7,6 +8,51 @@
 #include <unordered_map>
 #include <vector>
 #include <iostream>
+#include <limits>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <cmath>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#ifdef _WIN32
+//windows.hmin/max}Nstd::min/std::maxnumeric_limits<T>::max󂳂Ȃ悤ɂ
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//_̓WJSSE2g(UEM_NO_SIMD`ƎgȂ)
+#if !defined( UEM_NO_SIMD ) && ( defined( _M_X64 ) || defined( _M_IX86 ) || defined( __SSE2__ ) )
+#define UEM_SSE2
+#include <emmintrin.h>
+#include <xmmintrin.h>
+//AVXLɂărhꍇ̓Aj[V̕Ԃ8vfs
+#if defined( __AVX__ )
+#define UEM_AVX
+#include <immintrin.h>
+#endif
+#endif
 
 // Tvp̒`
 #include "SampleDef.h"
@@ -52,879 +98,8459 @@ private:
     char* m_activeData = nullptr;
 };
 
-enum class Flg
+// t@C}bvēǂݍރXg[
+// MapŕԂ|C^̓t@C̃AhX̂܂܎ŵŃRs[Ȃ
+class MappedFileStream
 {
-    POSITION = 0x0001,
-    NORMAL = 0x0002,
-    TANGENT = 0x0004,
-    UV1 = 0x0008,
-    UV2 = 0x0010,
-    UV3 = 0x0020,
-    UV4 = 0x0040,
-    UV5 = 0x0080,
-    UV6 = 0x0100,
-    UV7 = 0x0200,
-    UV8 = 0x0400,
-    COLOR = 0x0800,
-};
+public:
+    MappedFileStream() = default;
 
-static const std::vector<std::pair<Flg, int>> VertexFormatSizes
-{
-    { Flg::POSITION, 4 * 3 },
-    { Flg::NORMAL, 4 * 3 },
-    { Flg::TANGENT, 4 * 3 },
-    { Flg::UV1, 4 * 2 },
-    { Flg::UV2, 4 * 2 },
-    { Flg::UV3, 4 * 2 },
-    { Flg::UV4, 4 * 2 },
-    { Flg::UV5, 4 * 2 },
-    { Flg::UV6, 4 * 2 },
-    { Flg::UV7, 4 * 2 },
-    { Flg::UV8, 4 * 2 },
-    { Flg::COLOR, 4 * 4 },
-};
+    explicit MappedFileStream(const char* filename)
+    {
+        Load( filename );
+    }
 
-struct Material
-{
-private:
-    std::unordered_map<std::size_t, std::string> m_textureNames;
-    std::unordered_map<std::size_t, Float4> m_colors;
+    ~MappedFileStream()
+    {
+        Close();
+    }
 
-public:
-    std::string name;
+    MappedFileStream(const MappedFileStream&) = delete;
+    MappedFileStream& operator=(const MappedFileStream&) = delete;
 
-    static std::size_t GetHash(const std::string& property)
+    MappedFileStream(MappedFileStream&& other) noexcept
     {
-        return std::hash<std::string>()( property );
+        *this = std::move( other );
     }
 
-    void AddColor(const std::string& property, Float4 color)
+    MappedFileStream& operator=(MappedFileStream&& other) noexcept
     {
-        m_colors.insert( std::make_pair( GetHash( property ), color ) );
+        if ( this == &other )
+            return *this;
+        Close();
+#ifdef _WIN32
+        m_file = other.m_file;
+        m_mapping = other.m_mapping;
+        other.m_file = INVALID_HANDLE_VALUE;
+        other.m_mapping = nullptr;
+#else
+        m_fd = other.m_fd;
+        other.m_fd = -1;
+#endif
+        m_data = other.m_data;
+        m_size = other.m_size;
+        m_activeData = other.m_activeData;
+        other.m_data = nullptr;
+        other.m_size = 0;
+        other.m_activeData = nullptr;
+        return *this;
     }
 
-    void AddTexture(const std::string& property, const std::string& textureName)
+    bool Load(const char* filename)
     {
-        m_textureNames.insert( std::make_pair( GetHash( property ), textureName ) );
+        Close();
+#ifdef _WIN32
+        m_file = CreateFileA( filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_FLAG_SEQUENTIAL_SCAN, nullptr );
+        if ( m_file == INVALID_HANDLE_VALUE )
+            return false;
+        LARGE_INTEGER size;
+        GetFileSizeEx( m_file, &size );
+        m_size = static_cast<std::size_t>( size.QuadPart );
+        if ( m_size == 0 )
+            return true;
+        m_mapping = CreateFileMappingA( m_file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+        if ( m_mapping == nullptr )
+        {
+            Close();
+            return false;
+        }
+        m_data = static_cast<const char*>( MapViewOfFile( m_mapping, FILE_MAP_READ, 0, 0, 0 ) );
+#else
+        m_fd = open( filename, O_RDONLY );
+        if ( m_fd < 0 )
+            return false;
+        struct stat st{};
+        fstat( m_fd, &st );
+        m_size = static_cast<std::size_t>( st.st_size );
+        if ( m_size == 0 )
+            return true;
+        auto* mapped = mmap( nullptr, m_size, PROT_READ, MAP_PRIVATE, m_fd, 0 );
+        m_data = mapped == MAP_FAILED ? nullptr : static_cast<const char*>( mapped );
+#endif
+        if ( m_data == nullptr )
+        {
+            Close();
+            return false;
+        }
+        m_activeData = m_data;
+        return true;
     }
 
-    Float4 GetColor(const std::size_t propertyHash)
+    void Close()
     {
-        return m_colors[propertyHash];
+#ifdef _WIN32
+        if ( m_data )
+            UnmapViewOfFile( m_data );
+        if ( m_mapping )
+            CloseHandle( m_mapping );
+        if ( m_file != INVALID_HANDLE_VALUE )
+            CloseHandle( m_file );
+        m_mapping = nullptr;
+        m_file = INVALID_HANDLE_VALUE;
+#else
+        if ( m_data )
+            munmap( const_cast<char*>( m_data ), m_size );
+        if ( m_fd >= 0 )
+            close( m_fd );
+        m_fd = -1;
+#endif
+        m_data = nullptr;
+        m_activeData = nullptr;
+        m_size = 0;
     }
 
-    Float4 GetColor(const std::string& property)
+    void Read(void* data, const int size)
     {
-        return GetColor( GetHash( property ) );
+        std::memcpy( data, m_activeData, size );
+        m_activeData += size;
     }
 
-    std::string GetTexture(const std::size_t propertyHash)
+    // Rs[Ɍ݈ʒũ|C^Ԃēǂݐi߂
+    // t@C̃ACg͕ۏ؂Ȃ̂Œ
+    const char* Map(const std::size_t size)
     {
-        return m_textureNames[propertyHash];
+        const auto* ret = m_activeData;
+        m_activeData += size;
+        return ret;
     }
 
-    std::string GetTexture(const std::string& property)
+    bool IsOpen() const
     {
-        return GetTexture( GetHash( property ) );
+        return m_data != nullptr;
     }
 
-    bool operator ==(const std::string& a) const
+    const char* GetData() const
+    {
+        return m_data;
+    }
+
+    std::size_t GetSize() const
     {
-        return name == a;
+        return m_size;
     }
+
+private:
+#ifdef _WIN32
+    HANDLE m_file = INVALID_HANDLE_VALUE;
+    HANDLE m_mapping = nullptr;
+#else
+    int m_fd = -1;
+#endif
+    const char* m_data = nullptr;
+    const char* m_activeData = nullptr;
+    std::size_t m_size = 0;
 };
 
-template <class X>
-struct Model
+// ŒTCỸOobt@ăt@CǂݍރXg[
+// t@CTCYɊ֌WȂgp郁̓obt@TCYōς
+class StreamingFileStream
 {
-    struct Mesh
-    {
-        std::vector<X> vertexDatas;
-        std::vector<uint32_t> indexes;
-        int materialNo{};
-    };
+public:
+    static constexpr std::size_t DefaultBufferSize = 4 * 1024 * 1024;
 
-    std::vector<Mesh> m_meshes;
-    std::vector<Material> m_materials;
+    StreamingFileStream() = default;
 
-    void LoadAscii(std::string& filename)
+    explicit StreamingFileStream(const char* filename, const std::size_t bufferSize = DefaultBufferSize)
     {
-        std::ifstream ifs( filename );
-        auto lastSlash = filename.find_last_of( '/' );
-        filename.erase( lastSlash );
-        assert( ifs.is_open() );
+        Load( filename, bufferSize );
+    }
 
-        //_tH[}bgǂݍ
-        int vertexFormat;
-        ifs >> vertexFormat;
+    ~StreamingFileStream()
+    {
+        Close();
+    }
 
-        int modelCount;
-        ifs >> modelCount;
+    StreamingFileStream(const StreamingFileStream&) = delete;
+    StreamingFileStream& operator=(const StreamingFileStream&) = delete;
 
-        //tH[}bgG[`FbN
-        std::vector<bool> formatFlg;
-        formatFlg.resize( 12 );
-        auto totalByte = 0;
-        for ( auto i = 0; i < VertexFormatSizes.size(); i++ )
-            if ( vertexFormat & static_cast<int>(VertexFormatSizes[i].first) )
-                totalByte += VertexFormatSizes[i].second;
-        if ( totalByte != sizeof( X ) )
-        {
-            auto errorLog = std::string( typeid( X ).name() ) + " is " + std::to_string( sizeof( X ) ) + "\n " +
-                "The required size is " + std::to_string( totalByte ) + " bytes";
-            std::cout << errorLog;
-            return;
-        }
+    bool Load(const char* filename, const std::size_t bufferSize = DefaultBufferSize)
+    {
+        Close();
+#ifdef _WIN32
+        if ( fopen_s( &m_fp, filename, "rb" ) != 0 )
+            m_fp = nullptr;
+#else
+        m_fp = fopen( filename, "rb" );
+#endif
+        if ( m_fp == nullptr )
+            return false;
+        //OŃobt@ÔCRT̃obt@͎gȂ
+        setvbuf( m_fp, nullptr, _IONBF, 0 );
+        m_capacity = bufferSize;
+        m_buffer.reset( new char[m_capacity] );
+        m_head = 0;
+        m_count = 0;
+        return true;
+    }
 
-        for ( auto i = 0; i < modelCount; i++ )
+    void Close()
+    {
+        if ( m_fp )
+            fclose( m_fp );
+        m_fp = nullptr;
+        m_buffer.reset();
+        m_capacity = 0;
+        m_head = 0;
+        m_count = 0;
+        m_failed = false;
+    }
+
+    //t@C̏I[zēǂ񂾕0Ŗ߁AIsFailedtrueɂ
+    void Read(void* data, const int size)
+    {
+        auto* dst = static_cast<char*>( data );
+        auto remain = static_cast<std::size_t>( size );
+        while ( remain != 0 )
         {
-            Mesh model;
-            //_ǂݍ
-            int vertexCount;
-            ifs >> vertexCount;
-            for ( auto j = 0; j < vertexCount; j++ )
+            if ( m_count == 0 )
             {
-                uint8_t* rawData = new uint8_t[sizeof( X )];
-                auto rawCnt = 0;
-
-                for ( auto i2 = 0; i2 < VertexFormatSizes.size(); i2++ )
+                //obt@傫ǂݍ݂̓obt@oRړǂ
+                if ( remain >= m_capacity )
                 {
-                    if ( vertexFormat & static_cast<int>(VertexFormatSizes[i2].first) )
-                    {
-                        float tmpData[4];
-                        auto dataSize = VertexFormatSizes[i2].second / 4;
-                        for ( auto i1 = 0; i1 < dataSize; i1++ )
-                            ifs >> tmpData[i1];
-                        memcpy( &rawData[rawCnt], tmpData, VertexFormatSizes[i2].second );
-                        rawCnt += VertexFormatSizes[i2].second;
-                    }
+                    const auto read = fread( dst, sizeof( char ), remain, m_fp );
+                    if ( read != remain )
+                        Fail( dst + read, remain - read );
+                    return;
+                }
+                Fill();
+                if ( m_count == 0 )
+                {
+                    Fail( dst, remain );
+                    return;
                 }
-
-                X data;
-                memcpy( &data, rawData, sizeof( X ) );
-                delete[] rawData;
-                model.vertexDatas.push_back( data );
             }
+            auto chunk = m_capacity - m_head;
+            if ( chunk > m_count )
+                chunk = m_count;
+            if ( chunk > remain )
+                chunk = remain;
+            std::memcpy( dst, &m_buffer[m_head], chunk );
+            m_head = ( m_head + chunk ) % m_capacity;
+            m_count -= chunk;
+            dst += chunk;
+            remain -= chunk;
+        }
+    }
 
-            //CfbNXǂݍ
-            int indexCount;
-            ifs >> indexCount;
-            model.indexes.resize( indexCount );
-            for ( auto j = 0; j < indexCount; j++ )
-            {
-                ifs >> model.indexes[j];
-            }
+    bool IsOpen() const
+    {
+        return m_fp != nullptr;
+    }
 
-            //}eA̓ǂݍ
-            Material material;
-            ifs >> material.name;
-            int colorCount;
-            ifs >> colorCount;
-            for ( auto i1 = 0; i1 < colorCount; i1++ )
-            {
-                std::string propertyName;
-                ifs >> propertyName;
-                Float4 color;
-                ifs >> color.x >> color.y >> color.z >> color.w;
-                material.AddColor( propertyName, color );
-            }
+    //t@CrŐ؂Ăēǂݍ݂Ȃ
+    bool IsFailed() const
+    {
+        return m_failed;
+    }
 
-            int textureCount;
-            ifs >> textureCount;
-            for ( auto i1 = 0; i1 < textureCount; i1++ )
-            {
-                std::string propertyName;
-                ifs >> propertyName;
-                std::string textureName;
-                ifs >> textureName;
-                material.AddTexture( propertyName, filename + "/" + textureName );
-            }
+    std::size_t GetBufferSize() const
+    {
+        return m_capacity;
+    }
 
-            auto materialNo = -1;
-            for ( auto j = 0; j < static_cast<int>( m_materials.size() ); j++ )
-            {
-                if ( m_materials[j] == material.name )
-                    materialNo = j;
-            }
-            if ( materialNo == -1 )
-            {
-                materialNo = static_cast<int>( m_materials.size() );
-                m_materials.push_back( material );
-            }
-            model.materialNo = materialNo;
-            m_meshes.push_back( model );
-        }
+private:
+    void Fail(char* dst, const std::size_t size)
+    {
+        std::memset( dst, 0, size );
+        m_failed = true;
     }
 
-    void LoadBinary(std::string& filename)
+    //󂢂Ă̈܂Ƃ߂ēǂݍ(Ő܂Ԃꍇ2ɕ)
+    void Fill()
     {
-        FileStream fileStream( filename.c_str() );
-        auto lastSlash = filename.find_last_of( '/' );
-        filename.erase( lastSlash );
+        const auto tail = ( m_head + m_count ) % m_capacity;
+        const auto space = m_capacity - m_count;
+        const auto first = space < m_capacity - tail ? space : m_capacity - tail;
+        auto read = fread( &m_buffer[tail], sizeof( char ), first, m_fp );
+        m_count += read;
+        if ( read == first && space > first )
+            m_count += fread( &m_buffer[0], sizeof( char ), space - first, m_fp );
+    }
 
-        short vertexFormat;
-        fileStream.Read( &vertexFormat, sizeof( short ) );
+    FILE* m_fp = nullptr;
+    std::unique_ptr<char[]> m_buffer = nullptr;
+    std::size_t m_capacity = 0;
+    std::size_t m_head = 0;
+    std::size_t m_count = 0;
+    bool m_failed = false;
+};
 
-        uint16_t modelCount;
-        fileStream.Read( &modelCount, sizeof( uint16_t ) );
+// }bvt@C̔zwr[
+template <class T>
+struct ArrayView
+{
+    const T* ptr = nullptr;
+    std::size_t count = 0;
 
-        //tH[}bgG[`FbN
-        std::vector<bool> formatFlg;
-        formatFlg.resize( 12 );
-        auto totalByte = 0; //BoneIndex & BoneWeight
-        for ( auto i = 0; i < VertexFormatSizes.size(); i++ )
-            if ( vertexFormat & static_cast<short>(VertexFormatSizes[i].first) )
-                totalByte += VertexFormatSizes[i].second;
-        if ( totalByte != sizeof( X ) )
-        {
-            auto errorLog = std::string( typeid( X ).name() ) + " is " + std::to_string( sizeof( X ) ) + "\n " +
-                "The required size is " + std::to_string( totalByte ) + " bytes";
-            std::cout << errorLog;
-            return;
-        }
+    const T* data() const
+    {
+        return ptr;
+    }
 
-        for ( auto i = 0; i < modelCount; i++ )
-        {
-            Mesh model;
-            //_ǂݍ
-            uint32_t vertexCount;
-            fileStream.Read( &vertexCount, sizeof( uint32_t ) );
-            model.vertexDatas.resize( vertexCount );
-            fileStream.Read( &model.vertexDatas[0], sizeof( X ) * vertexCount );
+    std::size_t size() const
+    {
+        return count;
+    }
 
-            //CfbNXǂݍ
-            uint32_t indexCount;
-            fileStream.Read( &indexCount, sizeof( uint32_t ) );
-            model.indexes.resize( indexCount );
-            fileStream.Read( &model.indexes[0], sizeof( uint32_t ) * indexCount );
+    bool empty() const
+    {
+        return count == 0;
+    }
 
-            //}eA̓ǂݍ
-            Material material;
-            uint16_t materialNameCount;
-            fileStream.Read( &materialNameCount, sizeof( uint16_t ) );
-            material.name.resize( materialNameCount );
-            fileStream.Read( &material.name[0], sizeof( char ) * materialNameCount );
-
-            uint16_t colorCount;
-            fileStream.Read( &colorCount, sizeof( uint16_t ) );
-            for ( auto i1 = 0; i1 < colorCount; i1++ )
-            {
-                std::string propertyName;
-                uint16_t propertyNameCount;
-                fileStream.Read( &propertyNameCount, sizeof( uint16_t ) );
-                propertyName.resize( propertyNameCount );
-                fileStream.Read( &propertyName[0], sizeof( char ) * propertyNameCount );
-
-                Float4 color;
-                fileStream.Read( &color, sizeof( float ) * 4 );
-                material.AddColor( propertyName, color );
-            }
-
-            uint16_t textureCount;
-            fileStream.Read( &textureCount, sizeof( uint16_t ) );
-            for ( auto i1 = 0; i1 < textureCount; i1++ )
-            {
-                std::string propertyName;
-                uint16_t propertyNameCount;
-                fileStream.Read( &propertyNameCount, sizeof( uint16_t ) );
-                propertyName.resize( propertyNameCount );
-                fileStream.Read( &propertyName[0], sizeof( char ) * propertyNameCount );
-
-                std::string textureName;
-                uint16_t textureNameCount;
-                fileStream.Read( &textureNameCount, sizeof( uint16_t ) );
-                if ( textureNameCount == 0 )
-                {
-                    material.AddTexture( propertyName, "null" );
-                    continue;
-                }
-                textureName.resize( textureNameCount );
-                fileStream.Read( &textureName[0], sizeof( char ) * textureNameCount );
-                material.AddTexture( propertyName, filename + "/" + textureName );
-            }
+    const T* begin() const
+    {
+        return ptr;
+    }
 
-            auto materialNo = -1;
-            for ( auto j = 0; j < static_cast<int>( m_materials.size() ); j++ )
-            {
-                if ( m_materials[j] == material.name )
-                    materialNo = j;
-            }
-            if ( materialNo == -1 )
-            {
-                materialNo = static_cast<int>( m_materials.size() );
-                m_materials.push_back( material );
-            }
-            model.materialNo = materialNo;
-            m_meshes.push_back( model );
-        }
+    const T* end() const
+    {
+        return ptr + count;
+    }
+
+    const T& operator[](const std::size_t index) const
+    {
+        return ptr[index];
     }
 };
 
-template <class X>
-struct SkinnedModel
+//_ȉ̃bV̓CfbNX16bitŎ
+static constexpr std::size_t ShortIndexVertexLimit = 65536;
+
+inline std::size_t GetIndexStride(const std::size_t vertexCount)
 {
-    struct Mesh
+    return vertexCount <= ShortIndexVertexLimit ? sizeof( uint16_t ) : sizeof( uint32_t );
+}
+
+// 16bit32bit̃CfbNXwr[
+struct IndexView
+{
+    const void* ptr = nullptr;
+    std::size_t count = 0;
+    std::size_t stride = sizeof( uint32_t );
+
+    const void* data() const
     {
-        std::vector<X> vertexDatas;
-        std::vector<uint32_t> indexes;
-        std::vector<std::pair<Matrix, Transform*>> bones;
-        int materialNo;
-    };
+        return ptr;
+    }
 
-    std::vector<Mesh> m_meshes;
-    std::vector<Material> m_materials;
-    std::unique_ptr<Transform> m_root;
-    std::unordered_map<std::size_t, std::unique_ptr<Transform>> m_transformMap;
+    std::size_t size() const
+    {
+        return count;
+    }
 
-private:
-    void LoadHierarchyAscii(std::ifstream& ifs)
+    bool empty() const
     {
-        //f̊Kw\ǂݍ
-        auto active = m_root.get();
-        auto transformCount = 0;
+        return count == 0;
+    }
+
+    bool IsShort() const
+    {
+        return stride == sizeof( uint16_t );
+    }
+
+    std::size_t GetStride() const
+    {
+        return stride;
+    }
+
+    //`̃t@C𒼐ڎwꍇ͋EĂȂƂ̂memcpyœǂ
+    uint32_t operator[](const std::size_t index) const
+    {
+        const auto* bytes = static_cast<const char*>( ptr ) + stride * index;
+        if ( IsShort() )
         {
-            std::string tmp;
-            ifs >> tmp;
-            transformCount++;
-            active->m_name = tmp;
-            active->m_hash = std::hash<std::string>()( tmp );
-            ifs >> active->m_position.x >> active->m_position.y >> active->m_position.z;
-            Float3 euler;
-            ifs >> euler.x >> euler.y >> euler.z;
-            active->m_rotation = MakeQuaternion( euler );
-            ifs >> active->m_scale.x >> active->m_scale.y >> active->m_scale.z;
+            uint16_t value;
+            std::memcpy( &value, bytes, sizeof( uint16_t ) );
+            return value;
         }
-        while ( transformCount != 0 )
-        {
-            std::string tmp;
-            ifs >> tmp;
-            if ( tmp == "ChildEndTransform" )
-            {
-                transformCount--;
-                active = active->m_parent;
-                continue;
-            }
-            transformCount++;
-            auto newTrans = std::make_unique<Transform>();
-            newTrans->m_name = tmp;
-            newTrans->m_hash = std::hash<std::string>()( tmp );
-            ifs >> newTrans->m_position.x >> newTrans->m_position.y >> newTrans->m_position.z;
+        uint32_t value;
+        std::memcpy( &value, bytes, sizeof( uint32_t ) );
+        return value;
+    }
+};
 
-            Float3 euler;
-            ifs >> euler.x >> euler.y >> euler.z;
-            newTrans->m_rotation = MakeQuaternion( euler );
-            ifs >> newTrans->m_scale.x >> newTrans->m_scale.y >> newTrans->m_scale.z;
-            newTrans->m_parent = active;
-            active->m_child.push_back( newTrans.get() );
-            active = newTrans.get();
-            m_transformMap.insert( std::make_pair( newTrans->m_hash, std::move( newTrans ) ) );
-        }
+// bṼCfbNX
+// _ShortIndexVertexLimitȉȂ16bitAȊO32bitŊi[
+class IndexArray
+{
+public:
+    IndexArray() = default;
+
+    explicit IndexArray(std::pmr::memory_resource* resource)
+        : m_data( resource )
+    {
     }
 
-    void LoadHierarchyBinary(FileStream& fileStream)
+    //_`߂countmۂ
+    void Resize(const std::size_t count, const std::size_t vertexCount)
     {
-        auto active = m_root.get();
-        auto transformCount = 0;
+        m_stride = GetIndexStride( vertexCount );
+        m_count = count;
+        m_data.resize( ( count * m_stride + sizeof( uint32_t ) - 1 ) / sizeof( uint32_t ) );
+    }
+
+    //32bit̃CfbNX`ɍ킹ĕϊĊi[(src̋E͑ĂȂĂ悢)
+    void Assign(const void* src, const std::size_t count, const std::size_t vertexCount)
+    {
+        Resize( count, vertexCount );
+        if ( !IsShort() )
         {
-            std::string tmp;
-            short tmpCount;
-            fileStream.Read( &tmpCount, sizeof( short ) );
-            tmp.resize( tmpCount );
-            fileStream.Read( &tmp[0], sizeof( char ) * tmpCount );
-            transformCount++;
-            active->m_name = tmp;
-            active->m_hash = std::hash<std::string>()( tmp );
-            fileStream.Read( &active->m_position, sizeof( float ) * 3 );
-            Float3 euler;
-            fileStream.Read( &euler, sizeof( float ) * 3 );
-            active->m_rotation = MakeQuaternion( euler );
-            fileStream.Read( &active->m_scale, sizeof( float ) * 3 );
+            if ( count != 0 )
+                std::memcpy( m_data.data(), src, sizeof( uint32_t ) * count );
+            return;
         }
-        while ( transformCount != 0 )
+        const auto* bytes = static_cast<const char*>( src );
+        auto* dst = reinterpret_cast<uint16_t*>( m_data.data() );
+        for ( std::size_t i = 0; i < count; i++ )
         {
-            std::string tmp;
-            short tmpCount;
-            fileStream.Read( &tmpCount, sizeof( short ) );
-            if ( tmpCount == -1 )
-            {
-                transformCount--;
-                active = active->m_parent;
-                continue;
-            }
-            transformCount++;
-            tmp.resize( tmpCount );
-            fileStream.Read( &tmp[0], sizeof( char ) * tmpCount );
-
-            auto newTrans = std::make_unique<Transform>();
-            newTrans->m_name = tmp;
-            newTrans->m_hash = std::hash<std::string>()( tmp );
-
-            fileStream.Read( &newTrans->m_position, sizeof( float ) * 3 );
-            Float3 euler;
-            fileStream.Read( &euler, sizeof( float ) * 3 );
-            newTrans->m_rotation = MakeQuaternion( euler );
-            fileStream.Read( &newTrans->m_scale, sizeof( float ) * 3 );
-            newTrans->m_parent = active;
-            active->m_child.push_back( newTrans.get() );
-            active = newTrans.get();
-            m_transformMap.insert( std::make_pair( newTrans->m_hash, std::move( newTrans ) ) );
+            uint32_t index;
+            std::memcpy( &index, bytes + sizeof( uint32_t ) * i, sizeof( uint32_t ) );
+            dst[i] = static_cast<uint16_t>( index );
         }
     }
 
-public:
-    void LoadAscii(std::string filename)
+    void Set(const std::size_t index, const uint32_t value)
     {
-        m_root = std::make_unique<Transform>();
+        if ( IsShort() )
+            reinterpret_cast<uint16_t*>( m_data.data() )[index] = static_cast<uint16_t>( value );
+        else
+            m_data[index] = value;
+    }
 
-        std::ifstream ifs( filename );
+    //i[`̂܂܏ސ
+    void* GetBytes()
+    {
+        return m_data.data();
+    }
+
+    const void* data() const
+    {
+        return m_data.data();
+    }
+
+    std::size_t size() const
+    {
+        return m_count;
+    }
+
+    bool empty() const
+    {
+        return m_count == 0;
+    }
+
+    bool IsShort() const
+    {
+        return m_stride == sizeof( uint16_t );
+    }
+
+    std::size_t GetStride() const
+    {
+        return m_stride;
+    }
+
+    uint32_t operator[](const std::size_t index) const
+    {
+        return GetView()[index];
+    }
+
+    IndexView GetView() const
+    {
+        return IndexView{ m_data.data(), m_count, m_stride };
+    }
+
+private:
+    std::pmr::vector<uint32_t> m_data; //16bit̏ꍇ2l߂
+    std::size_t m_count = 0;
+    std::size_t m_stride = sizeof( uint32_t );
+};
+
+// ̃f[^ǂݍރXg[
+class MemoryStream
+{
+public:
+    MemoryStream() = default;
+
+    MemoryStream(const char* data, const std::size_t size)
+        : m_data( data ), m_activeData( data ), m_size( size )
+    {
+    }
+
+    void Read(void* data, const int size)
+    {
+        std::memcpy( data, m_activeData, size );
+        m_activeData += size;
+    }
+
+    const char* Map(const std::size_t size)
+    {
+        const auto* ret = m_activeData;
+        m_activeData += size;
+        return ret;
+    }
+
+    void Skip(const std::size_t size)
+    {
+        m_activeData += size;
+    }
+
+    std::size_t Tell() const
+    {
+        return static_cast<std::size_t>( m_activeData - m_data );
+    }
+
+    std::size_t GetSize() const
+    {
+        return m_size;
+    }
+
+private:
+    const char* m_data = nullptr;
+    const char* m_activeData = nullptr;
+    std::size_t m_size = 0;
+};
+
+// ASCII`ǂݍނ߂̃g[NiCU
+// 󔒋؂̃g[Nstd::from_charsŒڐlɕϊ̂ŃP[q[vmۂ̉e󂯂Ȃ
+class AsciiTokenizer
+{
+public:
+    AsciiTokenizer() = default;
+
+    AsciiTokenizer(const char* data, const std::size_t size)
+        : m_activeData( data ), m_end( data + size )
+    {
+    }
+
+    //̃g[N͈̔͂Ԃ
+    std::pair<const char*, const char*> Next()
+    {
+        while ( m_activeData != m_end && static_cast<unsigned char>( *m_activeData ) <= ' ' )
+            ++m_activeData;
+        const auto* begin = m_activeData;
+        while ( m_activeData != m_end && static_cast<unsigned char>( *m_activeData ) > ' ' )
+            ++m_activeData;
+        return std::make_pair( begin, m_activeData );
+    }
+
+    std::string ReadString()
+    {
+        const auto token = Next();
+        return std::string( token.first, token.second );
+    }
+
+    //Rs[Ƀt@C̕QƂ
+    std::string_view ReadStringView()
+    {
+        const auto token = Next();
+        return std::string_view( token.first, static_cast<std::size_t>( token.second - token.first ) );
+    }
+
+    template <class T>
+    void Read(T& value)
+    {
+        const auto token = Next();
+        std::from_chars( token.first, token.second, value );
+    }
+
+    void Read(float& value)
+    {
+        const auto token = Next();
+        if ( !ParseFloatFast( token.first, token.second, value ) )
+            std::from_chars( token.first, token.second, value );
+    }
+
+    template <class T>
+    void Read(T* values, const int count)
+    {
+        for ( auto i = 0; i < count; i++ )
+            Read( values[i] );
+    }
+
+    template <class T>
+    T Read()
+    {
+        T value{};
+        Read( value );
+        return value;
+    }
+
+    bool IsEnd() const
+    {
+        return m_activeData == m_end;
+    }
+
+    const char* GetPosition() const
+    {
+        return m_activeData;
+    }
+
+    void Seek(const char* position)
+    {
+        m_activeData = position;
+    }
+
+private:
+    //Exportero͂"-123.45678901"`̏ɕϊ
+    //10̗ݏ悪doubleŐmɕ\ꍇdoublȅZŕϊA
+    //ʂfloat̊ۂ߂̋E傤ǂɗƂfrom_charsɔCĐۂ߂ꂽlƈv
+    static bool ParseFloatFast(const char* first, const char* last, float& value)
+    {
+        static const double powerOf10[] = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+            1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+        const auto negative = first != last && *first == '-';
+        if ( negative )
+            ++first;
+        uint64_t mantissa = 0;
+        auto digitCount = 0;
+        auto fractionCount = 0;
+        auto fraction = false;
+        for ( ; first != last; ++first )
+        {
+            const auto c = *first;
+            if ( c >= '0' && c <= '9' )
+            {
+                mantissa = mantissa * 10 + static_cast<uint64_t>( c - '0' );
+                if ( ++digitCount > 15 )
+                    return false;
+                if ( fraction )
+                    fractionCount++;
+            }
+            else if ( c == '.' && !fraction )
+                fraction = true;
+            else
+                return false;
+        }
+        if ( digitCount == 0 || fractionCount > 22 )
+            return false;
+
+        auto result = static_cast<double>( mantissa ) / powerOf10[fractionCount];
+        if ( result != 0.0 )
+        {
+            uint64_t bits;
+            std::memcpy( &bits, &result, sizeof( double ) );
+            const auto exponent = static_cast<int>( ( bits >> 52 ) & 0x7FF ) - 1023;
+            const auto lowBits = bits & ( ( 1ULL << 29 ) - 1 );
+            if ( exponent < -126 || exponent > 127 || lowBits == ( 1ULL << 28 ) )
+                return false;
+        }
+        value = static_cast<float>( negative ? -result : result );
+        return true;
+    }
+
+    const char* m_activeData = nullptr;
+    const char* m_end = nullptr;
+};
+
+// ǂݍݏɎs邽߂̃Xbhv[
+class ThreadPool
+{
+public:
+    explicit ThreadPool(unsigned threadCount = std::thread::hardware_concurrency())
+    {
+        if ( threadCount == 0 )
+            threadCount = 1;
+        for ( unsigned i = 0; i < threadCount; i++ )
+            m_threads.emplace_back( [this] { WorkerLoop(); } );
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            m_exit = true;
+        }
+        m_condition.notify_all();
+        for ( auto& thread : m_threads )
+            thread.join();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    template <class F>
+    auto Enqueue(F&& func) -> std::future<decltype( func() )>
+    {
+        using Result = decltype( func() );
+        auto task = std::make_shared<std::packaged_task<Result()>>( std::forward<F>( func ) );
+        auto future = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            m_tasks.emplace( [task] { ( *task )(); } );
+        }
+        m_condition.notify_one();
+        return future;
+    }
+
+    //0count-1܂ł[J[ƌĂяoXbhŕSďASďI܂ő҂
+    //҂Ԃ̓L[Ɏc^XNĂяoXbhŎŝŁA[J[ĂяoĂ~܂Ȃ
+    //funcO𓊂ꍇ͎c̏ł؂A[J[SnextfuncgIĂŏ̗O𓊂
+    template <class F>
+    void ParallelFor(const std::size_t count, F&& func)
+    {
+        if ( count == 0 )
+            return;
+        std::atomic<std::size_t> next( 0 );
+        auto work = [&next, count, &func]
+        {
+            try
+            {
+                for ( auto i = next++; i < count; i = next++ )
+                    func( i );
+            }
+            catch ( ... )
+            {
+                next = count;
+                throw;
+            }
+        };
+        auto helperCount = m_threads.size() < count - 1 ? m_threads.size() : count - 1;
+        std::vector<std::future<void>> futures;
+        std::exception_ptr error;
+        try
+        {
+            futures.reserve( helperCount );
+            for ( std::size_t i = 0; i < helperCount; i++ )
+                futures.push_back( Enqueue( work ) );
+            work();
+        }
+        catch ( ... )
+        {
+            error = std::current_exception();
+            next = count;
+        }
+        for ( auto& future : futures )
+        {
+            while ( future.wait_for( std::chrono::seconds( 0 ) ) != std::future_status::ready )
+            {
+                if ( !RunPendingTask() )
+                    future.wait();
+            }
+            try
+            {
+                future.get();
+            }
+            catch ( ... )
+            {
+                if ( !error )
+                    error = std::current_exception();
+            }
+        }
+        if ( error )
+            std::rethrow_exception( error );
+    }
+
+    std::size_t GetThreadCount() const
+    {
+        return m_threads.size();
+    }
+
+    static ThreadPool& GetDefault()
+    {
+        static ThreadPool threadPool;
+        return threadPool;
+    }
+
+private:
+    //L[̐擪̃^XN1s(Ȃfalse)
+    bool RunPendingTask()
+    {
+        std::function<void()> task;
+        {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            if ( m_tasks.empty() )
+                return false;
+            task = std::move( m_tasks.front() );
+            m_tasks.pop();
+        }
+        task();
+        return true;
+    }
+
+    void WorkerLoop()
+    {
+        while ( true )
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock( m_mutex );
+                m_condition.wait( lock, [this] { return m_exit || !m_tasks.empty(); } );
+                if ( m_exit && m_tasks.empty() )
+                    return;
+                task = std::move( m_tasks.front() );
+                m_tasks.pop();
+            }
+            task();
+        }
+    }
+
+    std::vector<std::thread> m_threads;
+    std::queue<std::function<void()>> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_exit = false;
+};
+
+// ǂݍ񂾃f[^܂Ƃ߂ĊmۂA[i
+// Ȋmۂ傫ȃubN؂oA̓A[i̔jɈxōs
+// ǂݍ݂̃[J[mۂ̂Ŕr
+// ModelȂǂ̃[u̓A[imۂo[󂯎ĂÂA[iA[uɂ͐ṼA[iĎc
+// ([ułA[imۂ̂noexceptɂ͂Ȃ)
+class Arena : public std::pmr::memory_resource
+{
+public:
+    static constexpr std::size_t InitialBlockSize = 64 * 1024;
+
+    explicit Arena(std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+        : m_buffer( InitialBlockSize, upstream )
+    {
+    }
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+private:
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment) override
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        return m_buffer.allocate( bytes, alignment );
+    }
+
+    void do_deallocate(void*, std::size_t, std::size_t) override
+    {
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    std::pmr::monotonic_buffer_resource m_buffer;
+    std::mutex m_mutex;
+};
+
+// memory_resourcemۂIuWFNgp̃f[^
+template <class T>
+struct ResourceDelete
+{
+    std::pmr::memory_resource* resource = nullptr;
+
+    void operator()(T* ptr) const
+    {
+        ptr->~T();
+        resource->deallocate( ptr, sizeof( T ), alignof( T ) );
+    }
+};
+
+template <class T>
+using ResourcePtr = std::unique_ptr<T, ResourceDelete<T>>;
+
+//resourcemۂAT̃RXgN^ɂresourcen
+template <class T>
+ResourcePtr<T> MakeResourcePtr(std::pmr::memory_resource* resource)
+{
+    return ResourcePtr<T>( new( resource->allocate( sizeof( T ), alignof( T ) ) ) T( resource ),
+                           ResourceDelete<T>{ resource } );
+}
+
+//pmr̃ReĩAP[^[͑ł͒uȂ̂ŁA蒼resourcemۂ悤ɂ
+template <class T>
+void ResetResourceMember(T& member, std::pmr::memory_resource* resource)
+{
+    member.~T();
+    new( &member ) T( resource );
+}
+
+//dst蒼srcAP[^[ƈڂ(dst̗vf͌̃AP[^[ŉ)
+template <class T>
+void MoveResourceMember(T& dst, T&& src)
+{
+    dst.~T();
+    new( &dst ) T( std::move( src ) );
+}
+
+// ASCII`̃g[Nԍʒu߂̍
+// t@CTCỸubNɕAeubNOɂg[NɐĂ
+class AsciiTokenIndex
+{
+public:
+    static constexpr std::size_t BlockSize = 16 * 1024;
+
+    AsciiTokenIndex(const char* data, const std::size_t size, ThreadPool& threadPool)
+        : m_data( data ), m_size( size )
+    {
+        const auto blockCount = ( size + BlockSize - 1 ) / BlockSize;
+        m_firstTokens.resize( blockCount + 1 );
+        threadPool.ParallelFor( blockCount, [this](const std::size_t i)
+        {
+            const auto begin = i * BlockSize;
+            const auto end = begin + BlockSize < m_size ? begin + BlockSize : m_size;
+            m_firstTokens[i + 1] = CountTokens( begin, end );
+        } );
+        for ( std::size_t i = 0; i < blockCount; i++ )
+            m_firstTokens[i + 1] += m_firstTokens[i];
+    }
+
+    //positionOn܂g[N̐
+    uint64_t IndexOf(const char* position) const
+    {
+        const auto offset = static_cast<std::size_t>( position - m_data );
+        const auto block = offset / BlockSize;
+        return m_firstTokens[block] + CountTokens( block * BlockSize, offset );
+    }
+
+    //indexԖڂ̃g[N̐擪(݂ȂΏI[)
+    const char* Find(const uint64_t index) const
+    {
+        if ( index >= m_firstTokens.back() )
+            return m_data + m_size;
+        const auto block = static_cast<std::size_t>(
+            std::upper_bound( m_firstTokens.begin(), m_firstTokens.end(), index ) - m_firstTokens.begin() ) - 1;
+        auto remain = index - m_firstTokens[block];
+        for ( auto i = block * BlockSize; ; i++ )
+            if ( IsTokenBegin( i ) && remain-- == 0 )
+                return m_data + i;
+    }
+
+private:
+    bool IsTokenBegin(const std::size_t i) const
+    {
+        return static_cast<unsigned char>( m_data[i] ) > ' ' &&
+            ( i == 0 || static_cast<unsigned char>( m_data[i - 1] ) <= ' ' );
+    }
+
+    uint64_t CountTokens(const std::size_t begin, const std::size_t end) const
+    {
+        uint64_t count = 0;
+        for ( auto i = begin; i < end; i++ )
+            count += IsTokenBegin( i ) ? 1 : 0;
+        return count;
+    }
+
+    const char* m_data;
+    std::size_t m_size;
+    std::vector<uint64_t> m_firstTokens;
+};
+
+enum class Flg
+{
+    POSITION = 0x0001,
+    NORMAL = 0x0002,
+    TANGENT = 0x0004,
+    UV1 = 0x0008,
+    UV2 = 0x0010,
+    UV3 = 0x0020,
+    UV4 = 0x0040,
+    UV5 = 0x0080,
+    UV6 = 0x0100,
+    UV7 = 0x0200,
+    UV8 = 0x0400,
+    COLOR = 0x0800,
+};
+
+static const std::vector<std::pair<Flg, int>> VertexFormatSizes
+{
+    { Flg::POSITION, 4 * 3 },
+    { Flg::NORMAL, 4 * 3 },
+    { Flg::TANGENT, 4 * 3 },
+    { Flg::UV1, 4 * 2 },
+    { Flg::UV2, 4 * 2 },
+    { Flg::UV3, 4 * 2 },
+    { Flg::UV4, 4 * 2 },
+    { Flg::UV5, 4 * 2 },
+    { Flg::UV6, 4 * 2 },
+    { Flg::UV7, 4 * 2 },
+    { Flg::UV8, 4 * 2 },
+    { Flg::COLOR, 4 * 4 },
+};
+
+//SĂ̗vf܂ޒ_̃oCg(BoneIndex & BoneWeight͊܂܂Ȃ)
+static constexpr int MaxVertexFormatSize = 4 * 3 * 3 + 4 * 2 * 8 + 4 * 4;
+
+struct Material
+{
+private:
+    std::pmr::unordered_map<std::size_t, std::pmr::string> m_textureNames;
+    std::pmr::unordered_map<std::size_t, Float4> m_colors;
+
+public:
+    std::pmr::string name;
+
+    Material() = default;
+
+    //OƃvpeBresourcemۂ
+    explicit Material(std::pmr::memory_resource* resource)
+        : m_textureNames( resource ), m_colors( resource ), name( resource )
+    {
+    }
+
+    static std::size_t GetHash(const std::string& property)
+    {
+        return std::hash<std::string>()( property );
+    }
+
+    void AddColor(const std::string& property, Float4 color)
+    {
+        m_colors.insert( std::make_pair( GetHash( property ), color ) );
+    }
+
+    void AddTexture(const std::string& property, const std::string& textureName)
+    {
+        m_textureNames.emplace( GetHash( property ), textureName );
+    }
+
+    Float4 GetColor(const std::size_t propertyHash)
+    {
+        return m_colors[propertyHash];
+    }
+
+    Float4 GetColor(const std::string& property)
+    {
+        return GetColor( GetHash( property ) );
+    }
+
+    std::string GetTexture(const std::size_t propertyHash)
+    {
+        const auto itr = m_textureNames.find( propertyHash );
+        if ( itr == m_textureNames.end() )
+            return std::string();
+        return std::string( itr->second );
+    }
+
+    std::string GetTexture(const std::string& property)
+    {
+        return GetTexture( GetHash( property ) );
+    }
+
+    bool operator ==(const std::string& a) const
+    {
+        return std::string_view( name ) == a;
+    }
+};
+
+//_tH[}bg1_̃oCg߂
+inline int GetVertexFormatSize(const int vertexFormat)
+{
+    auto totalByte = 0;
+    for ( auto i = 0; i < VertexFormatSizes.size(); i++ )
+        if ( vertexFormat & static_cast<int>(VertexFormatSizes[i].first) )
+            totalByte += VertexFormatSizes[i].second;
+    return totalByte;
+}
+
+//_̌^t@CƍȂꍇ̃G[o(CheckVertexSizeCheckVertexFormatŋ)
+inline void LogVertexError(const std::string& errorLog)
+{
+    std::cout << errorLog << '\n';
+}
+
+//_̌^̃TCY`FbN
+template <class X>
+bool CheckVertexSize(const std::size_t totalByte)
+{
+    if ( totalByte != sizeof( X ) )
+    {
+        LogVertexError( std::string( typeid( X ).name() ) + " is " + std::to_string( sizeof( X ) ) + "\n " +
+            "The required size is " + std::to_string( totalByte ) + " bytes" );
+        return false;
+    }
+    return true;
+}
+
+//_vf̈k`
+//Rei`VertexEncodingZNVɏ݁AFlgŎw肵vf菬`Ŋi[
+enum class EncodeFlg
+{
+    POSITION_UNORM16 = 0x0001, //bṼoEfBO{bNX16bitŗʎq(xyz + pfBO)
+    NORMAL_OCT16 = 0x0002, //ʑ̃GR[h16bit snorm x2
+    UV_HALF = 0x0004, //SĂUVhalf x2
+    BONE_INDEX_UINT8 = 0x0008, //{[ԍuint8 x4 (255܂)
+    BONE_WEIGHT_UNORM8 = 0x0010, //EFCgunorm8 x4
+};
+
+static const std::vector<std::pair<EncodeFlg, int>> VertexEncodeSizes
+{
+    { EncodeFlg::POSITION_UNORM16, 2 * 4 },
+    { EncodeFlg::NORMAL_OCT16, 2 * 2 },
+    { EncodeFlg::UV_HALF, 2 * 2 },
+    { EncodeFlg::BONE_INDEX_UINT8, 1 * 4 },
+    { EncodeFlg::BONE_WEIGHT_UNORM8, 1 * 4 },
+};
+
+//bV̎soEfBO{bNX
+struct Bounds
+{
+    Float3 min;
+    Float3 max;
+};
+
+//JOp̃bV̋E
+struct MeshBounds
+{
+    Bounds box; //soEfBO{bNX
+    Float3 center; //E̒S(box̒S)
+    float radius; //E̔a
+};
+
+//_̐擪ɂʒuMeshBounds߂(stride1_̃oCg)
+inline MeshBounds ComputeMeshBounds(const char* vertices, const std::size_t count, const std::size_t stride)
+{
+    MeshBounds bounds{};
+    if ( count == 0 )
+        return bounds;
+    std::memcpy( &bounds.box.min, vertices, sizeof( Float3 ) );
+    bounds.box.max = bounds.box.min;
+    for ( std::size_t i = 1; i < count; i++ )
+    {
+        Float3 position;
+        std::memcpy( &position, vertices + stride * i, sizeof( Float3 ) );
+        bounds.box.min = Float3( std::min<float>( bounds.box.min.x, position.x ), std::min<float>( bounds.box.min.y, position.y ),
+                                 std::min<float>( bounds.box.min.z, position.z ) );
+        bounds.box.max = Float3( std::max<float>( bounds.box.max.x, position.x ), std::max<float>( bounds.box.max.y, position.y ),
+                                 std::max<float>( bounds.box.max.z, position.z ) );
+    }
+    bounds.center = Float3( ( bounds.box.min.x + bounds.box.max.x ) * 0.5f, ( bounds.box.min.y + bounds.box.max.y ) * 0.5f,
+                            ( bounds.box.min.z + bounds.box.max.z ) * 0.5f );
+    //abox̑Ίp̔ł͂ȂSł_܂ł̋ɂ
+    auto radiusSq = 0.0f;
+    for ( std::size_t i = 0; i < count; i++ )
+    {
+        Float3 position;
+        std::memcpy( &position, vertices + stride * i, sizeof( Float3 ) );
+        const auto x = position.x - bounds.center.x;
+        const auto y = position.y - bounds.center.y;
+        const auto z = position.z - bounds.center.z;
+        radiusSq = std::max<float>( radiusSq, x * x + y * y + z * z );
+    }
+    bounds.radius = std::sqrt( radiusSq );
+    return bounds;
+}
+
+//{[ƂɃEFCg0傫_x[X|[Y(t@C̕т4x4s)ŃoChԂɈڂBounds߂
+//skinOffset͒_BoneIndex & BoneWeighẗʒuŁAe钸_{[min > max̋BoundsɂȂ
+inline std::vector<Bounds> ComputeBoneBounds(const char* vertices, const std::size_t count, const std::size_t stride,
+                                             const std::size_t skinOffset,
+                                             const std::vector<std::array<float, 16>>& bindPoses)
+{
+    constexpr auto maxValue = ( std::numeric_limits<float>::max )();
+    std::vector<Bounds> bounds(
+        bindPoses.size(), Bounds{ Float3( maxValue, maxValue, maxValue ), Float3( -maxValue, -maxValue, -maxValue ) } );
+    for ( std::size_t i = 0; i < count; i++ )
+    {
+        Float3 position;
+        std::memcpy( &position, vertices + stride * i, sizeof( Float3 ) );
+        uint32_t boneIndex[4];
+        float boneWeight[4];
+        std::memcpy( boneIndex, vertices + stride * i + skinOffset, sizeof( boneIndex ) );
+        std::memcpy( boneWeight, vertices + stride * i + skinOffset + sizeof( boneIndex ), sizeof( boneWeight ) );
+        for ( auto j = 0; j < 4; j++ )
+        {
+            if ( !( boneWeight[j] > 0.0f ) || boneIndex[j] >= bindPoses.size() )
+                continue;
+            const auto& m = bindPoses[boneIndex[j]];
+            const Float3 bindPosition( m[0] * position.x + m[1] * position.y + m[2] * position.z + m[3],
+                                       m[4] * position.x + m[5] * position.y + m[6] * position.z + m[7],
+                                       m[8] * position.x + m[9] * position.y + m[10] * position.z + m[11] );
+            auto& bone = bounds[boneIndex[j]];
+            bone.min = Float3( std::min<float>( bone.min.x, bindPosition.x ), std::min<float>( bone.min.y, bindPosition.y ),
+                               std::min<float>( bone.min.z, bindPosition.z ) );
+            bone.max = Float3( std::max<float>( bone.max.x, bindPosition.x ), std::max<float>( bone.max.y, bindPosition.y ),
+                               std::max<float>( bone.max.z, bindPosition.z ) );
+        }
+    }
+    return bounds;
+}
+
+// _^̗vf̕
+// ModelSkinnedModelɎw肷ƁAt@C̒_vfƂɂ̕т֕ϊēǂݍ
+// vf̌`̓t@CƓ(BoneIndexuint32_t x4AȊOfloat)
+struct VertexLayout
+{
+    //FlgɖXLbV̗vf
+    static constexpr int BONE_INDEX = 0x10000;
+    static constexpr int BONE_WEIGHT = 0x20000;
+
+    struct Element
+    {
+        Element(const Flg flg, const std::size_t offset)
+            : element( static_cast<int>( flg ) ), offset( static_cast<uint32_t>( offset ) )
+        {
+        }
+
+        Element(const int element, const std::size_t offset)
+            : element( element ), offset( static_cast<uint32_t>( offset ) )
+        {
+        }
+
+        int element; //FlgBONE_INDEX/BONE_WEIGHT
+        uint32_t offset; //_̃oCgʒu
+    };
+
+    std::vector<Element> elements;
+    std::size_t stride = 0; //1_̃oCg
+
+    VertexLayout() = default;
+
+    VertexLayout(const std::initializer_list<Element> elements, const std::size_t stride)
+        : elements( elements ), stride( stride )
+    {
+    }
+
+    bool empty() const
+    {
+        return elements.empty();
+    }
+
+    const Element* Find(const int element) const
+    {
+        for ( const auto& e : elements )
+            if ( e.element == element )
+                return &e;
+        return nullptr;
+    }
+
+    static int GetElementSize(const int element)
+    {
+        if ( element == BONE_INDEX || element == BONE_WEIGHT )
+            return 16;
+        for ( const auto& format : VertexFormatSizes )
+            if ( static_cast<int>( format.first ) == element )
+                return format.second;
+        return 0;
+    }
+
+    //SĂ̗vfmstrideɎ܂Ă邩
+    bool IsValid() const
+    {
+        for ( const auto& e : elements )
+        {
+            const auto size = GetElementSize( e.element );
+            if ( size == 0 || e.offset + size > stride )
+                return false;
+        }
+        return true;
+    }
+};
+
+//_̌^̗vf̋Lq
+//X static constexpr std::array<uem::VertexAttribute, N> VertexAttributes() `
+//҂钸_tH[}bgEǂݍݎ̕ϊE̓CAEgRpCɋ߂
+struct VertexAttribute
+{
+    constexpr VertexAttribute(const Flg flg, const std::size_t offset, const std::size_t size)
+        : element( static_cast<int>( flg ) ), offset( offset ), size( size )
+    {
+    }
+
+    constexpr VertexAttribute(const int element, const std::size_t offset, const std::size_t size)
+        : element( element ), offset( offset ), size( size )
+    {
+    }
+
+    int element; //FlgVertexLayout::BONE_INDEX/BONE_WEIGHT
+    std::size_t offset; //offsetof
+    std::size_t size; //osizeof(vf̃TCYƈقȂ΃RpCG[)
+};
+
+//̓CAEg̗vf̌^
+enum class VertexElementFormat
+{
+    FLOAT2,
+    FLOAT3,
+    FLOAT4,
+    UINT4,
+};
+
+//OtBbNXAPI̓̓CAEg邽߂̗vf̋Lq
+struct VertexInputElement
+{
+    const char* semanticName;
+    uint32_t semanticIndex;
+    VertexElementFormat format;
+    uint32_t slot; //_Xg[ɕt@Cł͈ʒu0A{[ȊO̗vf1A{[2
+    uint32_t offset;
+};
+
+//vf̃oCg(VertexFormatSizesconstexprŁAm̗vf0)
+constexpr int GetVertexElementSize(const int element)
+{
+    switch ( element )
+    {
+    case static_cast<int>( Flg::POSITION ):
+    case static_cast<int>( Flg::NORMAL ):
+    case static_cast<int>( Flg::TANGENT ):
+        return 4 * 3;
+    case static_cast<int>( Flg::UV1 ):
+    case static_cast<int>( Flg::UV2 ):
+    case static_cast<int>( Flg::UV3 ):
+    case static_cast<int>( Flg::UV4 ):
+    case static_cast<int>( Flg::UV5 ):
+    case static_cast<int>( Flg::UV6 ):
+    case static_cast<int>( Flg::UV7 ):
+    case static_cast<int>( Flg::UV8 ):
+        return 4 * 2;
+    case static_cast<int>( Flg::COLOR ):
+    case VertexLayout::BONE_INDEX:
+    case VertexLayout::BONE_WEIGHT:
+        return 4 * 4;
+    default:
+        return 0;
+    }
+}
+
+//vfLqȂ^(t@C̒_tH[}bgƃTCYvĂKv)
+template <class X, class = void>
+struct VertexReflection
+{
+    static constexpr bool enabled = false;
+};
+
+template <class X>
+struct VertexReflection<X, std::void_t<decltype( X::VertexAttributes() )>>
+{
+    static constexpr bool enabled = true;
+    static constexpr auto attributes = X::VertexAttributes();
+    static constexpr std::size_t count = attributes.size();
+
+    //vfmŃTCYĂāAdȂ炸XɎ܂Ă邩
+    static constexpr bool IsValid()
+    {
+        for ( std::size_t i = 0; i < count; i++ )
+        {
+            const auto& a = attributes[i];
+            const auto size = static_cast<std::size_t>( GetVertexElementSize( a.element ) );
+            if ( size == 0 || a.size != size || a.offset + size > sizeof( X ) )
+                return false;
+            for ( std::size_t j = 0; j < i; j++ )
+            {
+                const auto& b = attributes[j];
+                if ( a.element == b.element || ( a.offset < b.offset + b.size && b.offset < a.offset + a.size ) )
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    static_assert( IsValid(), "VertexAttributes() must list known elements with matching sizes and no overlap" );
+
+    static constexpr bool Has(const int element)
+    {
+        for ( const auto& a : attributes )
+            if ( a.element == element )
+                return true;
+        return false;
+    }
+
+    //Xvt@C̒_tH[}bg(BoneIndex & BoneWeight͊܂܂Ȃ)
+    static constexpr int GetVertexFormat()
+    {
+        auto format = 0;
+        for ( const auto& a : attributes )
+            if ( a.element != VertexLayout::BONE_INDEX && a.element != VertexLayout::BONE_WEIGHT )
+                format |= a.element;
+        return format;
+    }
+
+    static constexpr int vertexFormat = GetVertexFormat();
+    static constexpr bool skinned = Has( VertexLayout::BONE_INDEX ) && Has( VertexLayout::BONE_WEIGHT );
+
+    //Xt@C̕(Flg̏ABoneIndex & BoneWeight)ƓŁÂ܂܃Rs[ł邩
+    static constexpr bool IsFileOrder()
+    {
+        std::size_t offset = 0;
+        for ( auto bit = 1; bit <= static_cast<int>( Flg::COLOR ); bit <<= 1 )
+        {
+            if ( !( vertexFormat & bit ) )
+                continue;
+            for ( const auto& a : attributes )
+                if ( a.element == bit && a.offset != offset )
+                    return false;
+            offset += GetVertexElementSize( bit );
+        }
+        for ( const auto element : { VertexLayout::BONE_INDEX, VertexLayout::BONE_WEIGHT } )
+        {
+            if ( !Has( element ) )
+                continue;
+            for ( const auto& a : attributes )
+                if ( a.element == element && a.offset != offset )
+                    return false;
+            offset += GetVertexElementSize( element );
+        }
+        return offset == sizeof( X );
+    }
+
+    static constexpr bool fileOrder = IsFileOrder();
+
+    static const VertexLayout& GetLayout()
+    {
+        static const VertexLayout layout = []
+        {
+            VertexLayout result;
+            for ( const auto& a : attributes )
+                result.elements.emplace_back( a.element, a.offset );
+            result.stride = sizeof( X );
+            return result;
+        }();
+        return layout;
+    }
+
+    //X̒_obt@1{ŕ`悷̓CAEg(splitStreamsȂt@C̒_Xg[Ƃ̃Xbgɕ)
+    static constexpr std::array<VertexInputElement, count> GetInputElements(const bool splitStreams = false)
+    {
+        std::array<VertexInputElement, count> elements{};
+        for ( std::size_t i = 0; i < count; i++ )
+        {
+            const auto element = attributes[i].element;
+            auto& e = elements[i];
+            e.semanticIndex = 0;
+            e.slot = 0;
+            e.offset = static_cast<uint32_t>( attributes[i].offset );
+            switch ( element )
+            {
+            case static_cast<int>( Flg::POSITION ):
+                e.semanticName = "POSITION";
+                break;
+            case static_cast<int>( Flg::NORMAL ):
+                e.semanticName = "NORMAL";
+                break;
+            case static_cast<int>( Flg::TANGENT ):
+                e.semanticName = "TANGENT";
+                break;
+            case static_cast<int>( Flg::COLOR ):
+                e.semanticName = "COLOR";
+                break;
+            case VertexLayout::BONE_INDEX:
+                e.semanticName = "BONEINDEX";
+                break;
+            case VertexLayout::BONE_WEIGHT:
+                e.semanticName = "BONEWEIGHT";
+                break;
+            default: //UV1`UV8
+                e.semanticName = "TEXCOORD";
+                for ( auto bit = element; bit > static_cast<int>( Flg::UV1 ); bit >>= 1 )
+                    e.semanticIndex++;
+                break;
+            }
+            const auto size = GetVertexElementSize( element );
+            e.format = element == VertexLayout::BONE_INDEX ? VertexElementFormat::UINT4
+                : size == 8 ? VertexElementFormat::FLOAT2
+                : size == 12 ? VertexElementFormat::FLOAT3
+                : VertexElementFormat::FLOAT4;
+            if ( splitStreams && element != static_cast<int>( Flg::POSITION ) )
+            {
+                //{[ȊO̗vfFlg̏A{[BoneIndexEBoneWeight̏ɋl߂
+                const auto bone = element == VertexLayout::BONE_INDEX || element == VertexLayout::BONE_WEIGHT;
+                e.slot = bone ? 2 : 1;
+                e.offset = 0;
+                for ( const auto& a : attributes )
+                {
+                    const auto otherBone = a.element == VertexLayout::BONE_INDEX || a.element == VertexLayout::BONE_WEIGHT;
+                    if ( a.element < element && otherBone == bone && a.element != static_cast<int>( Flg::POSITION ) )
+                        e.offset += GetVertexElementSize( a.element );
+                }
+            }
+        }
+        return elements;
+    }
+
+    //t@C̕(k)̒_Xɕϊ
+    //sourceOffsetsattributes̏̃t@C̈ʒu(t@Cɖvf͕̒lX̊l̂܂)
+    static void Decode(const char* src, const std::size_t srcStride, const int* sourceOffsets, const std::size_t vertexCount,
+                       void* dst)
+    {
+        Decode( src, srcStride, sourceOffsets, vertexCount, static_cast<char*>( dst ), std::make_index_sequence<count>() );
+    }
+
+private:
+    template <std::size_t... I>
+    static void Decode(const char* src, const std::size_t srcStride, const int* sourceOffsets, const std::size_t vertexCount,
+                       char* dst, std::index_sequence<I...>)
+    {
+        //vfƂɃTCYXł̈ʒu萔ɂȂ̂ŁAmemcpy͌Œ蒷̓]ɓWJ
+        const std::array<int, count> offsets{ sourceOffsets[I]... };
+        for ( std::size_t i = 0; i < vertexCount; i++ )
+        {
+            const auto* vertex = src + srcStride * i;
+            auto* out = dst + sizeof( X ) * i;
+            ( ( offsets[I] >= 0 ? std::memcpy( out + attributes[I].offset, vertex + offsets[I], attributes[I].size ) : nullptr ), ... );
+        }
+    }
+};
+
+//tH[}bgG[`FbN
+//XvfLqꍇ͒_tH[}bgƕтvĂKv
+template <class X>
+bool CheckVertexFormat(const int vertexFormat, const int extraByte)
+{
+    if constexpr ( VertexReflection<X>::enabled )
+    {
+        using Reflection = VertexReflection<X>;
+        if ( vertexFormat != Reflection::vertexFormat || ( extraByte != 0 ) != Reflection::skinned ||
+            !Reflection::fileOrder )
+        {
+            LogVertexError( std::string( typeid( X ).name() ) + " does not match the vertex format " +
+                std::to_string( vertexFormat ) );
+            return false;
+        }
+    }
+    return CheckVertexSize<X>( extraByte + GetVertexFormatSize( vertexFormat ) );
+}
+
+// k_ƌ̕(SvffloatAXLbVBoneIndex & BoneWeight)̒_𑊌݂ɕϊ
+// ϊ͗vfƂɂ܂Ƃ߂čsASSE2gꍇ1_̗vf܂Ƃ߂ĕϊ
+// layoutw肷ƓWJ̕тɂ(^ɖvf͎̂āAt@Cɖvf͏܂Ȃ)BEncodeɂ͎gȂ
+class VertexCodec
+{
+public:
+    VertexCodec(const int vertexFormat, const int encoding, const bool skinned, const VertexLayout* layout = nullptr)
+    {
+        auto packedOffset = 0;
+        auto offset = 0;
+        auto add = [&](const int element, const Codec codec, const int size, const int packedSize)
+        {
+            m_packedOffsets.emplace_back( element, packedOffset );
+            const auto* target = layout != nullptr ? layout->Find( element ) : nullptr;
+            if ( layout == nullptr || target != nullptr )
+            {
+                const auto dstOffset = target != nullptr ? static_cast<int>( target->offset ) : offset;
+                //A閳ϊ̗vf͈ɂ܂Ƃ߂
+                if ( codec == Codec::Copy && !m_attributes.empty() && m_attributes.back().codec == Codec::Copy &&
+                    m_attributes.back().offset + m_attributes.back().size == dstOffset &&
+                    m_attributes.back().packedOffset + m_attributes.back().size == packedOffset )
+                    m_attributes.back().size += size;
+                else
+                    m_attributes.push_back( Attribute{ codec, packedOffset, dstOffset, size } );
+            }
+            packedOffset += packedSize;
+            offset += size;
+        };
+        auto encoded = [&](const EncodeFlg flg)
+        {
+            return ( encoding & static_cast<int>( flg ) ) != 0;
+        };
+        auto encodeSize = [](const EncodeFlg flg)
+        {
+            for ( const auto& size : VertexEncodeSizes )
+                if ( size.first == flg )
+                    return size.second;
+            return 0;
+        };
+
+        for ( const auto& format : VertexFormatSizes )
+        {
+            if ( !( vertexFormat & static_cast<int>( format.first ) ) )
+                continue;
+            auto flg = EncodeFlg::POSITION_UNORM16;
+            auto codec = Codec::Unorm16x3;
+            if ( format.first == Flg::NORMAL )
+            {
+                flg = EncodeFlg::NORMAL_OCT16;
+                codec = Codec::Oct16;
+            }
+            else if ( format.first >= Flg::UV1 && format.first <= Flg::UV8 )
+            {
+                flg = EncodeFlg::UV_HALF;
+                codec = Codec::Half2;
+            }
+            else if ( format.first != Flg::POSITION )
+            {
+                add( static_cast<int>( format.first ), Codec::Copy, format.second, format.second );
+                continue;
+            }
+            if ( encoded( flg ) )
+            {
+                m_encoding |= static_cast<int>( flg );
+                add( static_cast<int>( format.first ), codec, format.second, encodeSize( flg ) );
+            }
+            else
+                add( static_cast<int>( format.first ), Codec::Copy, format.second, format.second );
+        }
+        if ( skinned )
+        {
+            //BoneIndex & BoneWeight
+            for ( const auto flg : { EncodeFlg::BONE_INDEX_UINT8, EncodeFlg::BONE_WEIGHT_UNORM8 } )
+            {
+                const auto element = flg == EncodeFlg::BONE_INDEX_UINT8 ? VertexLayout::BONE_INDEX : VertexLayout::BONE_WEIGHT;
+                if ( encoded( flg ) )
+                {
+                    m_encoding |= static_cast<int>( flg );
+                    add( element, flg == EncodeFlg::BONE_INDEX_UINT8 ? Codec::Uint8x4 : Codec::Unorm8x4, 16, encodeSize( flg ) );
+                }
+                else
+                    add( element, Codec::Copy, 16, 16 );
+            }
+        }
+        m_packedVertexSize = packedOffset;
+        m_vertexSize = layout != nullptr ? layout->stride : offset;
+    }
+
+    //_tH[}bgɊ܂܂vfɍik`
+    int GetEncoding() const
+    {
+        return m_encoding;
+    }
+
+    std::size_t GetVertexSize() const
+    {
+        return m_vertexSize;
+    }
+
+    std::size_t GetPackedVertexSize() const
+    {
+        return m_packedVertexSize;
+    }
+
+    //kבւÂ܂܃Rs[΂悢
+    bool IsIdentity() const
+    {
+        if ( m_encoding != 0 || m_packedVertexSize != m_vertexSize )
+            return false;
+        if ( m_attributes.empty() )
+            return m_vertexSize == 0;
+        const auto& attribute = m_attributes.front();
+        return m_attributes.size() == 1 && attribute.offset == 0 && attribute.packedOffset == 0 &&
+            static_cast<std::size_t>( attribute.size ) == m_vertexSize;
+    }
+
+    //_̍W܂ތ̕т̒_oEfBO{bNX߂
+    Bounds ComputeBounds(const char* vertices, const std::size_t count) const
+    {
+        Bounds bounds{};
+        if ( count == 0 || m_attributes.empty() || m_attributes[0].offset != 0 )
+            return bounds;
+        std::memcpy( &bounds.min, vertices, sizeof( Float3 ) );
+        bounds.max = bounds.min;
+        for ( std::size_t i = 1; i < count; i++ )
+        {
+            Float3 position;
+            std::memcpy( &position, vertices + m_vertexSize * i, sizeof( Float3 ) );
+            bounds.min = Float3( std::min<float>( bounds.min.x, position.x ), std::min<float>( bounds.min.y, position.y ),
+                                 std::min<float>( bounds.min.z, position.z ) );
+            bounds.max = Float3( std::max<float>( bounds.max.x, position.x ), std::max<float>( bounds.max.y, position.y ),
+                                 std::max<float>( bounds.max.z, position.z ) );
+        }
+        return bounds;
+    }
+
+    //X̗vf̕тRpCɕꍇAk̒_Xɓꉻϊg
+    //(VertexReflection<X>::GetLayout()nčcodecɎg)
+    template <class X>
+    void Specialize()
+    {
+        using Reflection = VertexReflection<X>;
+        if ( m_encoding != 0 || m_vertexSize != sizeof( X ) )
+            return;
+        m_sourceOffsets.assign( Reflection::count, -1 );
+        for ( std::size_t i = 0; i < Reflection::count; i++ )
+            for ( const auto& packed : m_packedOffsets )
+                if ( packed.first == Reflection::attributes[i].element )
+                    m_sourceOffsets[i] = packed.second;
+        m_specializedDecode = &Reflection::Decode;
+    }
+
+    //count̈k_̕тɕϊ
+    void Decode(const char* src, const std::size_t count, const Bounds& bounds, void* dst) const
+    {
+        if ( m_specializedDecode != nullptr )
+        {
+            m_specializedDecode( src, m_packedVertexSize, m_sourceOffsets.data(), count, dst );
+            return;
+        }
+        //ݐ悪LbVɎc悤萔Svfϊ
+        constexpr std::size_t chunkSize = 256;
+        auto* out = static_cast<char*>( dst );
+        for ( std::size_t first = 0; first < count; first += chunkSize )
+        {
+            const auto chunk = std::min<std::size_t>( chunkSize, count - first );
+            for ( const auto& attribute : m_attributes )
+                DecodeAttribute( attribute, src + m_packedVertexSize * first, out + m_vertexSize * first, chunk, bounds );
+        }
+    }
+
+    //count̌̕т̒_k
+    //{[ԍ255𒴂ꍇfalseԂ
+    bool Encode(const char* src, const std::size_t count, const Bounds& bounds, char* dst) const
+    {
+        for ( std::size_t i = 0; i < count; i++ )
+        {
+            const auto* vertex = src + m_vertexSize * i;
+            auto* packed = dst + m_packedVertexSize * i;
+            for ( const auto& attribute : m_attributes )
+            {
+                if ( !EncodeAttribute( attribute, vertex + attribute.offset, packed + attribute.packedOffset, bounds ) )
+                    return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    enum class Codec
+    {
+        Copy,
+        Unorm16x3,
+        Oct16,
+        Half2,
+        Uint8x4,
+        Unorm8x4,
+    };
+
+    struct Attribute
+    {
+        Codec codec;
+        int packedOffset;
+        int offset;
+        int size;
+    };
+
+    static float HalfToFloat(const uint16_t half)
+    {
+        //w炵Ă2^112|Ɣ񐳋K܂߂ĐlɂȂ
+        const uint32_t expmant = half & 0x7fff;
+        const uint32_t shifted = expmant << 13;
+        float scaled;
+        std::memcpy( &scaled, &shifted, sizeof( float ) );
+        scaled *= 5.192296858534828e+33f;
+        uint32_t bits;
+        std::memcpy( &bits, &scaled, sizeof( float ) );
+        bits |= static_cast<uint32_t>( half & 0x8000 ) << 16;
+        if ( expmant > 0x7bff )
+            bits |= 255u << 23;
+        float result;
+        std::memcpy( &result, &bits, sizeof( float ) );
+        return result;
+    }
+
+    static uint16_t FloatToHalf(const float value)
+    {
+        uint32_t bits;
+        std::memcpy( &bits, &value, sizeof( float ) );
+        const auto sign = static_cast<uint16_t>( ( bits >> 16 ) & 0x8000 );
+        const auto exponent = static_cast<int>( ( bits >> 23 ) & 0xff ) - 127 + 15;
+        auto mantissa = bits & 0x7fffff;
+        if ( ( ( bits >> 23 ) & 0xff ) == 0xff )
+            return static_cast<uint16_t>( sign | 0x7c00 | ( mantissa != 0 ? 0x200 : 0 ) );
+        if ( exponent >= 31 )
+            return static_cast<uint16_t>( sign | 0x7c00 );
+        if ( exponent <= 0 )
+        {
+            if ( exponent < -10 )
+                return sign;
+            //񐳋K(ŋߐڋɊۂ߂)
+            mantissa |= 0x800000;
+            const auto shift = static_cast<uint32_t>( 14 - exponent );
+            auto half = mantissa >> shift;
+            const auto rest = mantissa & ( ( 1u << shift ) - 1 );
+            const auto halfway = 1u << ( shift - 1 );
+            if ( rest > halfway || ( rest == halfway && ( half & 1 ) ) )
+                half++;
+            return static_cast<uint16_t>( sign | half );
+        }
+        auto half = static_cast<uint32_t>( exponent << 10 ) | ( mantissa >> 13 );
+        const auto rest = mantissa & 0x1fff;
+        if ( rest > 0x1000 || ( rest == 0x1000 && ( half & 1 ) ) )
+            half++; //JオŎwĂl(܂)ɂȂ
+        return static_cast<uint16_t>( sign | half );
+    }
+
+    template <class T>
+    static T Load(const char* src)
+    {
+        T value;
+        std::memcpy( &value, src, sizeof( T ) );
+        return value;
+    }
+
+    template <class T>
+    static void Store(char* dst, const T& value)
+    {
+        std::memcpy( dst, &value, sizeof( T ) );
+    }
+
+#ifdef UEM_SSE2
+    static void Store3(char* dst, const __m128 value)
+    {
+        _mm_storel_pi( reinterpret_cast<__m64*>( dst ), value );
+        _mm_store_ss( reinterpret_cast<float*>( dst ) + 2, _mm_movehl_ps( value, value ) );
+    }
+
+    //HalfToFloat4vf܂Ƃ߂čs
+    static __m128 HalfToFloat4(const __m128i half)
+    {
+        const auto expmant = _mm_and_si128( half, _mm_set1_epi32( 0x7fff ) );
+        const auto scaled = _mm_mul_ps( _mm_castsi128_ps( _mm_slli_epi32( expmant, 13 ) ),
+                                        _mm_set1_ps( 5.192296858534828e+33f ) );
+        const auto sign = _mm_slli_epi32( _mm_and_si128( half, _mm_set1_epi32( 0x8000 ) ), 16 );
+        const auto infnan = _mm_and_si128( _mm_cmpgt_epi32( expmant, _mm_set1_epi32( 0x7bff ) ),
+                                           _mm_set1_epi32( 255 << 23 ) );
+        return _mm_castsi128_ps( _mm_or_si128( _mm_castps_si128( scaled ), _mm_or_si128( sign, infnan ) ) );
+    }
+#endif
+
+    static void DecodeUnorm16x3(const char* src, const std::size_t srcStride, char* dst, const std::size_t dstStride,
+                                const std::size_t count, const Bounds& bounds)
+    {
+        const float scale[3] = {
+            ( bounds.max.x - bounds.min.x ) / 65535.0f, ( bounds.max.y - bounds.min.y ) / 65535.0f,
+            ( bounds.max.z - bounds.min.z ) / 65535.0f
+        };
+        const float offset[3] = { bounds.min.x, bounds.min.y, bounds.min.z };
+#ifdef UEM_SSE2
+        const auto vscale = _mm_setr_ps( scale[0], scale[1], scale[2], 0.0f );
+        const auto voffset = _mm_setr_ps( offset[0], offset[1], offset[2], 0.0f );
+        for ( std::size_t i = 0; i < count; i++ )
+        {
+            const auto quantized = _mm_unpacklo_epi16(
+                _mm_loadl_epi64( reinterpret_cast<const __m128i*>( src + srcStride * i ) ), _mm_setzero_si128() );
+            Store3( dst + dstStride * i, _mm_add_ps( _mm_mul_ps( _mm_cvtepi32_ps( quantized ), vscale ), voffset ) );
+        }
+#else
+        for ( std::size_t i = 0; i < count; i++ )
+        {
+            for ( auto k = 0; k < 3; k++ )
+            {
+                const auto quantized = Load<uint16_t>( src + srcStride * i + sizeof( uint16_t ) * k );
+                Store( dst + dstStride * i + sizeof( float ) * k, static_cast<float>( quantized ) * scale[k] + offset[k] );
+            }
+        }
+#endif
+    }
+
+    //ʑ̃GR[h̕(SSE2̏ꍇ4_܂Ƃ߂ČvZ)
+    static void DecodeOct16(const char* src, const std::size_t srcStride, char* dst, const std::size_t dstStride,
+                            const std::size_t count)
+    {
+        constexpr auto inverse = 1.0f / 32767.0f;
+        std::size_t i = 0;
+#ifdef UEM_SSE2
+        const auto zero = _mm_setzero_ps();
+        const auto one = _mm_set1_ps( 1.0f );
+        const auto minusOne = _mm_set1_ps( -1.0f );
+        const auto absMask = _mm_castsi128_ps( _mm_set1_epi32( 0x7fffffff ) );
+        for ( ; i + 4 <= count; i += 4 )
+        {
+            const auto packed = _mm_setr_epi32( Load<int32_t>( src + srcStride * i ),
+                                                Load<int32_t>( src + srcStride * ( i + 1 ) ),
+                                                Load<int32_t>( src + srcStride * ( i + 2 ) ),
+                                                Load<int32_t>( src + srcStride * ( i + 3 ) ) );
+            auto x = _mm_mul_ps( _mm_cvtepi32_ps( _mm_srai_epi32( _mm_slli_epi32( packed, 16 ), 16 ) ),
+                                 _mm_set1_ps( inverse ) );
+            auto y = _mm_mul_ps( _mm_cvtepi32_ps( _mm_srai_epi32( packed, 16 ) ), _mm_set1_ps( inverse ) );
+            x = _mm_max_ps( x, minusOne );
+            y = _mm_max_ps( y, minusOne );
+            auto z = _mm_sub_ps( _mm_sub_ps( one, _mm_and_ps( x, absMask ) ), _mm_and_ps( y, absMask ) );
+            const auto t = _mm_max_ps( _mm_sub_ps( zero, z ), zero );
+            const auto negativeT = _mm_sub_ps( zero, t );
+            const auto xMask = _mm_cmpge_ps( x, zero );
+            const auto yMask = _mm_cmpge_ps( y, zero );
+            x = _mm_add_ps( x, _mm_or_ps( _mm_and_ps( xMask, negativeT ), _mm_andnot_ps( xMask, t ) ) );
+            y = _mm_add_ps( y, _mm_or_ps( _mm_and_ps( yMask, negativeT ), _mm_andnot_ps( yMask, t ) ) );
+            const auto length = _mm_sqrt_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( x, x ), _mm_mul_ps( y, y ) ),
+                                                         _mm_mul_ps( z, z ) ) );
+            x = _mm_div_ps( x, length );
+            y = _mm_div_ps( y, length );
+            z = _mm_div_ps( z, length );
+            auto w = zero;
+            _MM_TRANSPOSE4_PS( x, y, z, w );
+            Store3( dst + dstStride * i, x );
+            Store3( dst + dstStride * ( i + 1 ), y );
+            Store3( dst + dstStride * ( i + 2 ), z );
+            Store3( dst + dstStride * ( i + 3 ), w );
+        }
+#endif
+        for ( ; i < count; i++ )
+        {
+            auto x = static_cast<float>( Load<int16_t>( src + srcStride * i ) ) * inverse;
+            auto y = static_cast<float>( Load<int16_t>( src + srcStride * i + sizeof( int16_t ) ) ) * inverse;
+            x = x > -1.0f ? x : -1.0f;
+            y = y > -1.0f ? y : -1.0f;
+            auto z = 1.0f - std::fabs( x ) - std::fabs( y );
+            const auto negativeZ = 0.0f - z;
+            const auto t = negativeZ > 0.0f ? negativeZ : 0.0f;
+            x = x + ( x >= 0.0f ? 0.0f - t : t );
+            y = y + ( y >= 0.0f ? 0.0f - t : t );
+            const auto length = std::sqrt( x * x + y * y + z * z );
+            const float normal[3] = { x / length, y / length, z / length };
+            std::memcpy( dst + dstStride * i, normal, sizeof( normal ) );
+        }
+    }
+
+    static void DecodeHalf2(const char* src, const std::size_t srcStride, char* dst, const std::size_t dstStride,
+                            const std::size_t count)
+    {
+        std::size_t i = 0;
+#ifdef UEM_SSE2
+        for ( ; i + 2 <= count; i += 2 )
+        {
+            const auto packed = _mm_setr_epi32( Load<int32_t>( src + srcStride * i ),
+                                                Load<int32_t>( src + srcStride * ( i + 1 ) ), 0, 0 );
+            const auto value = HalfToFloat4( _mm_unpacklo_epi16( packed, _mm_setzero_si128() ) );
+            _mm_storel_pi( reinterpret_cast<__m64*>( dst + dstStride * i ), value );
+            _mm_storeh_pi( reinterpret_cast<__m64*>( dst + dstStride * ( i + 1 ) ), value );
+        }
+#endif
+        for ( ; i < count; i++ )
+        {
+            const float uv[2] = {
+                HalfToFloat( Load<uint16_t>( src + srcStride * i ) ),
+                HalfToFloat( Load<uint16_t>( src + srcStride * i + sizeof( uint16_t ) ) )
+            };
+            std::memcpy( dst + dstStride * i, uv, sizeof( uv ) );
+        }
+    }
+
+    static void DecodeUint8x4(const char* src, const std::size_t srcStride, char* dst, const std::size_t dstStride,
+                              const std::size_t count, const bool normalize)
+    {
+#ifdef UEM_SSE2
+        const auto zero = _mm_setzero_si128();
+        const auto scale = _mm_set1_ps( 1.0f / 255.0f );
+        for ( std::size_t i = 0; i < count; i++ )
+        {
+            const auto packed = _mm_cvtsi32_si128( Load<int32_t>( src + srcStride * i ) );
+            const auto value = _mm_unpacklo_epi16( _mm_unpacklo_epi8( packed, zero ), zero );
+            if ( normalize )
+                _mm_storeu_ps( reinterpret_cast<float*>( dst + dstStride * i ), _mm_mul_ps( _mm_cvtepi32_ps( value ), scale ) );
+            else
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( dst + dstStride * i ), value );
+        }
+#else
+        for ( std::size_t i = 0; i < count; i++ )
+        {
+            for ( auto k = 0; k < 4; k++ )
+            {
+                const auto value = static_cast<uint8_t>( src[srcStride * i + k] );
+                if ( normalize )
+                    Store( dst + dstStride * i + sizeof( float ) * k, static_cast<float>( value ) * ( 1.0f / 255.0f ) );
+                else
+                    Store( dst + dstStride * i + sizeof( uint32_t ) * k, static_cast<uint32_t>( value ) );
+            }
+        }
+#endif
+    }
+
+    template <std::size_t Size>
+    static void CopyFixed(const char* src, const std::size_t srcStride, char* dst, const std::size_t dstStride,
+                          const std::size_t count)
+    {
+        for ( std::size_t i = 0; i < count; i++ )
+            std::memcpy( dst + dstStride * i, src + srcStride * i, Size );
+    }
+
+    //vfRs[(vfAvfł悭TCY͌Œ蒷ɂăWX^Pʂ̃Rs[ɂ)
+    static void CopyElements(const char* src, const std::size_t srcStride, char* dst, const std::size_t dstStride,
+                             const std::size_t count, const int size)
+    {
+        switch ( size )
+        {
+        case 8:
+            CopyFixed<8>( src, srcStride, dst, dstStride, count );
+            break;
+        case 12:
+            CopyFixed<12>( src, srcStride, dst, dstStride, count );
+            break;
+        case 16:
+            CopyFixed<16>( src, srcStride, dst, dstStride, count );
+            break;
+        case 20:
+            CopyFixed<20>( src, srcStride, dst, dstStride, count );
+            break;
+        case 24:
+            CopyFixed<24>( src, srcStride, dst, dstStride, count );
+            break;
+        case 32:
+            CopyFixed<32>( src, srcStride, dst, dstStride, count );
+            break;
+        default:
+            for ( std::size_t i = 0; i < count; i++ )
+                std::memcpy( dst + dstStride * i, src + srcStride * i, size );
+            break;
+        }
+    }
+
+    void DecodeAttribute(const Attribute& attribute, const char* src, char* dst, const std::size_t count,
+                         const Bounds& bounds) const
+    {
+        src += attribute.packedOffset;
+        dst += attribute.offset;
+        switch ( attribute.codec )
+        {
+        case Codec::Copy:
+            CopyElements( src, m_packedVertexSize, dst, m_vertexSize, count, attribute.size );
+            break;
+        case Codec::Unorm16x3:
+            DecodeUnorm16x3( src, m_packedVertexSize, dst, m_vertexSize, count, bounds );
+            break;
+        case Codec::Oct16:
+            DecodeOct16( src, m_packedVertexSize, dst, m_vertexSize, count );
+            break;
+        case Codec::Half2:
+            DecodeHalf2( src, m_packedVertexSize, dst, m_vertexSize, count );
+            break;
+        case Codec::Uint8x4:
+            DecodeUint8x4( src, m_packedVertexSize, dst, m_vertexSize, count, false );
+            break;
+        case Codec::Unorm8x4:
+            DecodeUint8x4( src, m_packedVertexSize, dst, m_vertexSize, count, true );
+            break;
+        }
+    }
+
+    static bool EncodeAttribute(const Attribute& attribute, const char* src, char* dst, const Bounds& bounds)
+    {
+        switch ( attribute.codec )
+        {
+        case Codec::Copy:
+            std::memcpy( dst, src, attribute.size );
+            return true;
+        case Codec::Unorm16x3:
+            {
+                const float minimum[3] = { bounds.min.x, bounds.min.y, bounds.min.z };
+                const float maximum[3] = { bounds.max.x, bounds.max.y, bounds.max.z };
+                uint16_t quantized[4] = {};
+                for ( auto k = 0; k < 3; k++ )
+                {
+                    const auto scale = ( maximum[k] - minimum[k] ) / 65535.0f;
+                    if ( scale <= 0.0f )
+                        continue;
+                    const auto value = std::lround( ( Load<float>( src + sizeof( float ) * k ) - minimum[k] ) / scale );
+                    quantized[k] = static_cast<uint16_t>( std::min<long>( std::max<long>( value, 0L ), 65535L ) );
+                }
+                std::memcpy( dst, quantized, sizeof( quantized ) );
+                return true;
+            }
+        case Codec::Oct16:
+            {
+                auto x = Load<float>( src );
+                auto y = Load<float>( src + sizeof( float ) );
+                const auto z = Load<float>( src + sizeof( float ) * 2 );
+                const auto sum = std::fabs( x ) + std::fabs( y ) + std::fabs( z );
+                if ( sum > 0.0f )
+                {
+                    x /= sum;
+                    y /= sum;
+                }
+                if ( z < 0.0f )
+                {
+                    const auto foldedX = ( 1.0f - std::fabs( y ) ) * ( x >= 0.0f ? 1.0f : -1.0f );
+                    y = ( 1.0f - std::fabs( x ) ) * ( y >= 0.0f ? 1.0f : -1.0f );
+                    x = foldedX;
+                }
+                const int16_t quantized[2] = {
+                    static_cast<int16_t>( std::lround( std::min<float>( std::max<float>( x, -1.0f ), 1.0f ) * 32767.0f ) ),
+                    static_cast<int16_t>( std::lround( std::min<float>( std::max<float>( y, -1.0f ), 1.0f ) * 32767.0f ) )
+                };
+                std::memcpy( dst, quantized, sizeof( quantized ) );
+                return true;
+            }
+        case Codec::Half2:
+            {
+                const uint16_t half[2] = {
+                    FloatToHalf( Load<float>( src ) ), FloatToHalf( Load<float>( src + sizeof( float ) ) )
+                };
+                std::memcpy( dst, half, sizeof( half ) );
+                return true;
+            }
+        case Codec::Uint8x4:
+            for ( auto k = 0; k < 4; k++ )
+            {
+                const auto index = Load<uint32_t>( src + sizeof( uint32_t ) * k );
+                if ( index > 255 )
+                    return false;
+                dst[k] = static_cast<char>( index );
+            }
+            return true;
+        case Codec::Unorm8x4:
+            {
+                //ۂ߂v255ɂȂ悤ő̃EFCgŌ덷z
+                int quantized[4];
+                auto total = 0;
+                auto largest = 0;
+                for ( auto k = 0; k < 4; k++ )
+                {
+                    const auto weight = std::min<float>( std::max<float>( Load<float>( src + sizeof( float ) * k ), 0.0f ), 1.0f );
+                    quantized[k] = static_cast<int>( std::lround( weight * 255.0f ) );
+                    total += quantized[k];
+                    if ( quantized[k] > quantized[largest] )
+                        largest = k;
+                }
+                if ( total != 0 && std::abs( total - 255 ) <= 4 )
+                    quantized[largest] = std::min<int>( std::max<int>( quantized[largest] + 255 - total, 0 ), 255 );
+                for ( auto k = 0; k < 4; k++ )
+                    dst[k] = static_cast<char>( quantized[k] );
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::vector<Attribute> m_attributes;
+    std::vector<std::pair<int, int>> m_packedOffsets; //vfƂ̈k_̈ʒu
+    std::vector<int> m_sourceOffsets; //Specialize^̗vfƂ̈k_̈ʒu
+    void (*m_specializedDecode)(const char*, std::size_t, const int*, std::size_t, void*) = nullptr;
+    int m_encoding = 0;
+    std::size_t m_vertexSize = 0;
+    std::size_t m_packedVertexSize = 0;
+};
+
+// _Xg[̉tk
+// _32bit̗vf̕тƂĈAO̒_̓vfƂ̍zigzagăoCgƂ̖ʂɕבւ
+// ʂ16byte̃O[vɕAO[vƂ0/2/4/8bit̂ǂŕ\2bit̃wb_[Ŏ
+// [uint32_t _][uint32_t _̃oCg]̌ɁABlockVertexCount_Ƃɗvfʂ̏ŕ
+class VertexStreamCodec
+{
+public:
+    static constexpr std::size_t BlockVertexCount = 256;
+
+    static std::vector<char> Encode(const char* vertices, const std::size_t count, const std::size_t vertexSize)
+    {
+        std::vector<char> dst;
+        if ( vertexSize == 0 || vertexSize % sizeof( uint32_t ) != 0 )
+            return dst;
+        const auto header = std::array<uint32_t, 2>{
+            static_cast<uint32_t>( count ), static_cast<uint32_t>( vertexSize )
+        };
+        dst.insert( dst.end(), reinterpret_cast<const char*>( header.data() ),
+                    reinterpret_cast<const char*>( header.data() ) + sizeof( header ) );
+
+        const auto wordCount = vertexSize / sizeof( uint32_t );
+        std::vector<uint32_t> previous( wordCount, 0 );
+        uint32_t deltas[BlockVertexCount];
+        uint8_t plane[BlockVertexCount];
+        for ( std::size_t first = 0; first < count; first += BlockVertexCount )
+        {
+            const auto blockCount = std::min<std::size_t>( BlockVertexCount, count - first );
+            const auto paddedCount = ( blockCount + GroupSize - 1 ) / GroupSize * GroupSize;
+            for ( std::size_t word = 0; word < wordCount; word++ )
+            {
+                std::memset( deltas, 0, sizeof( deltas ) );
+                for ( std::size_t i = 0; i < blockCount; i++ )
+                {
+                    uint32_t value;
+                    std::memcpy( &value, vertices + vertexSize * ( first + i ) + sizeof( uint32_t ) * word, sizeof( uint32_t ) );
+                    const auto delta = static_cast<int32_t>( value - previous[word] );
+                    deltas[i] = ( static_cast<uint32_t>( delta ) << 1 ) ^ static_cast<uint32_t>( delta >> 31 );
+                    previous[word] = value;
+                }
+                for ( auto shift = 0; shift < 32; shift += 8 )
+                {
+                    for ( std::size_t i = 0; i < paddedCount; i++ )
+                        plane[i] = static_cast<uint8_t>( deltas[i] >> shift );
+                    EncodePlane( plane, paddedCount, dst );
+                }
+            }
+        }
+        return dst;
+    }
+
+    //wb_[ǂݍ
+    static bool ReadHeader(const char* src, const std::size_t size, std::size_t& count, std::size_t& vertexSize)
+    {
+        uint32_t header[2];
+        if ( size < sizeof( header ) )
+            return false;
+        std::memcpy( header, src, sizeof( header ) );
+        count = header[0];
+        vertexSize = header[1];
+        return vertexSize != 0 && vertexSize % sizeof( uint32_t ) == 0;
+    }
+
+    //dstcount * vertexSizeoCg(f[^Ăfalse)
+    static bool Decode(const char* src, const std::size_t size, void* dst, const std::size_t dstSize)
+    {
+        std::size_t count, vertexSize;
+        if ( !ReadHeader( src, size, count, vertexSize ) || count * vertexSize != dstSize )
+            return false;
+        const auto* data = reinterpret_cast<const uint8_t*>( src ) + sizeof( uint32_t ) * 2;
+        const auto* end = reinterpret_cast<const uint8_t*>( src ) + size;
+        auto* out = static_cast<char*>( dst );
+        const auto wordCount = vertexSize / sizeof( uint32_t );
+        std::vector<uint32_t> previous( wordCount, 0 );
+        //ubN̑Svf̖(vfƂ4)
+        std::vector<uint8_t> planes( wordCount * 4 * BlockVertexCount );
+        for ( std::size_t first = 0; first < count; first += BlockVertexCount )
+        {
+            const auto blockCount = std::min<std::size_t>( BlockVertexCount, count - first );
+            const auto paddedCount = ( blockCount + GroupSize - 1 ) / GroupSize * GroupSize;
+            for ( std::size_t plane = 0; plane < wordCount * 4; plane++ )
+            {
+                data = DecodePlane( data, end, planes.data() + BlockVertexCount * plane, paddedCount );
+                if ( data == nullptr )
+                    return false;
+            }
+            auto* blockOut = out + vertexSize * first;
+            std::size_t word = 0;
+#ifdef UEM_SSE2
+            //4vfבւ1_16byte
+            for ( ; word + 4 <= wordCount; word += 4 )
+            {
+                DecodeWords4( planes.data() + BlockVertexCount * 4 * word, blockCount, &previous[word],
+                              blockOut + sizeof( uint32_t ) * word, vertexSize );
+            }
+#endif
+            for ( ; word < wordCount; word++ )
+            {
+                previous[word] = DecodeWords( planes.data() + BlockVertexCount * 4 * word, blockCount, previous[word],
+                                              blockOut + sizeof( uint32_t ) * word, vertexSize );
+            }
+        }
+        return true;
+    }
+
+private:
+    static constexpr std::size_t GroupSize = 16;
+
+    //O[v̍őlgrbg߂(0:0bit 1:2bit 2:4bit 3:8bit)
+    static int GetGroupMode(const uint8_t* group)
+    {
+        uint8_t maximum = 0;
+        for ( std::size_t i = 0; i < GroupSize; i++ )
+            maximum = std::max<uint8_t>( maximum, group[i] );
+        return maximum == 0 ? 0 : maximum < 4 ? 1 : maximum < 16 ? 2 : 3;
+    }
+
+    //2bitiԖڂ̒li % 4oCgڂi / 4 * 2bitځA4biti % 8oCgڂi / 8 * 4bitڂɒu
+    static void EncodePlane(const uint8_t* plane, const std::size_t count, std::vector<char>& dst)
+    {
+        const auto groupCount = count / GroupSize;
+        const auto headerOffset = dst.size();
+        dst.resize( dst.size() + ( groupCount + 3 ) / 4, 0 );
+        for ( std::size_t g = 0; g < groupCount; g++ )
+        {
+            const auto* group = plane + GroupSize * g;
+            const auto mode = GetGroupMode( group );
+            dst[headerOffset + g / 4] = static_cast<char>( dst[headerOffset + g / 4] | ( mode << ( g % 4 * 2 ) ) );
+            uint8_t packed[GroupSize] = {};
+            switch ( mode )
+            {
+            case 1:
+                for ( std::size_t i = 0; i < GroupSize; i++ )
+                    packed[i % 4] |= static_cast<uint8_t>( group[i] << ( i / 4 * 2 ) );
+                dst.insert( dst.end(), packed, packed + 4 );
+                break;
+            case 2:
+                for ( std::size_t i = 0; i < GroupSize; i++ )
+                    packed[i % 8] |= static_cast<uint8_t>( group[i] << ( i / 8 * 4 ) );
+                dst.insert( dst.end(), packed, packed + 8 );
+                break;
+            case 3:
+                dst.insert( dst.end(), group, group + GroupSize );
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    //`Ƃ̃O[ṽoCg(0/4/8/16)
+    static std::size_t GetModeSize(const int mode)
+    {
+        return ( 0x10080400u >> ( mode * 8 ) ) & 0xff;
+    }
+
+    //ʂWJđ̃f[^Ԃ(Ȃnullptr)
+    //wb_[1byte4O[v̈ʒuɂ܂Ƃ߂ċ߁AO[vmsēWJł悤ɂ
+    static const uint8_t* DecodePlane(const uint8_t* data, const uint8_t* end, uint8_t* plane, const std::size_t count)
+    {
+        const auto groupCount = count / GroupSize;
+        const auto* header = data;
+        data += ( groupCount + 3 ) / 4;
+        if ( data > end )
+            return nullptr;
+        //planeBlockVertexCount̂ŁAgȂO[v(wb_[0)܂4WJĂ悢
+        for ( std::size_t g = 0; g < groupCount; g += 4 )
+        {
+            const auto modes = header[g / 4];
+            auto* group = plane + GroupSize * g;
+            if ( modes == 0 )
+            {
+                //ʃoCg̖ʂ͑S0̂Ƃ
+                std::memset( group, 0, GroupSize * 4 );
+                continue;
+            }
+            const auto mode0 = modes & 3;
+            const auto mode1 = ( modes >> 2 ) & 3;
+            const auto mode2 = ( modes >> 4 ) & 3;
+            const auto mode3 = modes >> 6;
+            const auto offset1 = GetModeSize( mode0 );
+            const auto offset2 = offset1 + GetModeSize( mode1 );
+            const auto offset3 = offset2 + GetModeSize( mode2 );
+            const auto total = offset3 + GetModeSize( mode3 );
+            const auto remain = static_cast<std::size_t>( end - data );
+            if ( remain < total )
+                return nullptr;
+            //16byteȏ゠Ό`ɂ炸16byteǂݍ߂
+            const auto overRead = remain >= total + GroupSize;
+            DecodeGroup( data, mode0, group, overRead );
+            DecodeGroup( data + offset1, mode1, group + GroupSize, overRead );
+            DecodeGroup( data + offset2, mode2, group + GroupSize * 2, overRead );
+            DecodeGroup( data + offset3, mode3, group + GroupSize * 3, overRead );
+            data += total;
+        }
+        return data;
+    }
+
+    //2bitiԖڂ̒li % 4oCgڂi / 4 * 2bitځA4biti % 8oCgڂi / 8 * 4bitڂo
+    static void DecodeGroup(const uint8_t* src, const int mode, uint8_t* group, const bool overRead)
+    {
+#ifdef UEM_SSE2
+        __m128i raw;
+        if ( overRead )
+            raw = _mm_loadu_si128( reinterpret_cast<const __m128i*>( src ) );
+        else
+        {
+            uint8_t tail[GroupSize] = {};
+            std::memcpy( tail, src, GetModeSize( mode ) );
+            raw = _mm_loadu_si128( reinterpret_cast<const __m128i*>( tail ) );
+        }
+        //\OȂ悤SĂ̌`œWJĂI
+        const auto bits2 = _mm_unpacklo_epi64( _mm_unpacklo_epi32( raw, _mm_srli_epi32( raw, 2 ) ),
+                                               _mm_unpacklo_epi32( _mm_srli_epi32( raw, 4 ), _mm_srli_epi32( raw, 6 ) ) );
+        const auto bits4 = _mm_unpacklo_epi64( raw, _mm_srli_epi16( raw, 4 ) );
+        const auto modes = _mm_set1_epi8( static_cast<char>( mode ) );
+        const auto select2 = _mm_and_si128( _mm_cmpeq_epi8( modes, _mm_set1_epi8( 1 ) ), _mm_set1_epi8( 0x03 ) );
+        const auto select4 = _mm_and_si128( _mm_cmpeq_epi8( modes, _mm_set1_epi8( 2 ) ), _mm_set1_epi8( 0x0f ) );
+        const auto select8 = _mm_cmpeq_epi8( modes, _mm_set1_epi8( 3 ) );
+        const auto value = _mm_or_si128( _mm_or_si128( _mm_and_si128( bits2, select2 ), _mm_and_si128( bits4, select4 ) ),
+                                         _mm_and_si128( raw, select8 ) );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( group ), value );
+#else
+        (void)overRead;
+        for ( std::size_t i = 0; i < GroupSize; i++ )
+        {
+            switch ( mode )
+            {
+            case 0:
+                group[i] = 0;
+                break;
+            case 1:
+                group[i] = ( src[i % 4] >> ( i / 4 * 2 ) ) & 0x03;
+                break;
+            case 2:
+                group[i] = ( src[i % 8] >> ( i / 8 * 4 ) ) & 0x0f;
+                break;
+            default:
+                group[i] = src[i];
+                break;
+            }
+        }
+#endif
+    }
+
+    //4̖ʂ32bitɑgݒAzigzag߂č𑫂킹(Ō̒lԂ)
+    static uint32_t DecodeWords(const uint8_t* planes, const std::size_t count, uint32_t previous, char* dst,
+                                const std::size_t stride)
+    {
+        for ( std::size_t i = 0; i < count; i++ )
+        {
+            const auto zigzag = static_cast<uint32_t>( planes[i] ) |
+                static_cast<uint32_t>( planes[BlockVertexCount + i] ) << 8 |
+                static_cast<uint32_t>( planes[BlockVertexCount * 2 + i] ) << 16 |
+                static_cast<uint32_t>( planes[BlockVertexCount * 3 + i] ) << 24;
+            previous += ( zigzag >> 1 ) ^ ( 0u - ( zigzag & 1 ) );
+            std::memcpy( dst + stride * i, &previous, sizeof( uint32_t ) );
+        }
+        return previous;
+    }
+
+#ifdef UEM_SSE2
+    //DecodeWordsA4vf܂Ƃ߂čs(16_vZA4x4œ]uĒ_Ƃɏ)
+    static void DecodeWords4(const uint8_t* planes, const std::size_t count, uint32_t* previous, char* dst,
+                             const std::size_t stride)
+    {
+        __m128i last[4];
+        for ( auto c = 0; c < 4; c++ )
+            last[c] = _mm_set1_epi32( static_cast<int32_t>( previous[c] ) );
+        const auto one = _mm_set1_epi32( 1 );
+        std::size_t i = 0;
+        for ( ; i + GroupSize <= count; i += GroupSize )
+        {
+            __m128 words[4][4]; //[vf][4_]
+            for ( auto c = 0; c < 4; c++ )
+            {
+                const auto* plane = planes + BlockVertexCount * 4 * c + i;
+                const auto p0 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( plane ) );
+                const auto p1 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( plane + BlockVertexCount ) );
+                const auto p2 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( plane + BlockVertexCount * 2 ) );
+                const auto p3 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( plane + BlockVertexCount * 3 ) );
+                const auto low01 = _mm_unpacklo_epi8( p0, p1 );
+                const auto high01 = _mm_unpackhi_epi8( p0, p1 );
+                const auto low23 = _mm_unpacklo_epi8( p2, p3 );
+                const auto high23 = _mm_unpackhi_epi8( p2, p3 );
+                const __m128i zigzags[4] = {
+                    _mm_unpacklo_epi16( low01, low23 ), _mm_unpackhi_epi16( low01, low23 ),
+                    _mm_unpacklo_epi16( high01, high23 ), _mm_unpackhi_epi16( high01, high23 )
+                };
+                for ( auto k = 0; k < 4; k++ )
+                {
+                    //zigzag߂Ă4_̗ݐϘa
+                    auto delta = _mm_xor_si128( _mm_srli_epi32( zigzags[k], 1 ),
+                                                _mm_sub_epi32( _mm_setzero_si128(), _mm_and_si128( zigzags[k], one ) ) );
+                    delta = _mm_add_epi32( delta, _mm_slli_si128( delta, 4 ) );
+                    delta = _mm_add_epi32( delta, _mm_slli_si128( delta, 8 ) );
+                    const auto value = _mm_add_epi32( delta, last[c] );
+                    last[c] = _mm_shuffle_epi32( value, 0xff );
+                    words[c][k] = _mm_castsi128_ps( value );
+                }
+            }
+            for ( auto k = 0; k < 4; k++ )
+            {
+                auto row0 = words[0][k];
+                auto row1 = words[1][k];
+                auto row2 = words[2][k];
+                auto row3 = words[3][k];
+                _MM_TRANSPOSE4_PS( row0, row1, row2, row3 );
+                auto* out = dst + stride * ( i + k * 4 );
+                _mm_storeu_ps( reinterpret_cast<float*>( out ), row0 );
+                _mm_storeu_ps( reinterpret_cast<float*>( out + stride ), row1 );
+                _mm_storeu_ps( reinterpret_cast<float*>( out + stride * 2 ), row2 );
+                _mm_storeu_ps( reinterpret_cast<float*>( out + stride * 3 ), row3 );
+            }
+        }
+        for ( auto c = 0; c < 4; c++ )
+        {
+            previous[c] = DecodeWords( planes + BlockVertexCount * 4 * c + i, count - i,
+                                       static_cast<uint32_t>( _mm_cvtsi128_si32( last[c] ) ),
+                                       dst + sizeof( uint32_t ) * c + stride * i, stride );
+        }
+    }
+#endif
+};
+
+// Op`Xg̃CfbNX̉tk
+// O̎Op`̕(t)16܂FIFOɕێALӂFIFÖʒuƎc1_ŕ\
+// _́u܂ł̍ől + 1vȂtÔ݁AȊO͒O̒_Ƃ̍zigzag + ϒŏ
+// [uint32_t CfbNX][Op`Ƃ̃R[h1byte][ϒ̍]̏ɕсAOp`̏Ԃƒ_̕т͂̂܂ܖ߂
+class IndexStreamCodec
+{
+public:
+    static std::vector<char> Encode(const IndexView& indexes)
+    {
+        std::vector<char> dst;
+        const auto indexCount = static_cast<uint32_t>( indexes.size() );
+        if ( indexCount % 3 != 0 )
+            return dst;
+        dst.resize( sizeof( uint32_t ) + indexCount / 3 );
+        std::memcpy( dst.data(), &indexCount, sizeof( uint32_t ) );
+
+        EdgeFifo fifo;
+        uint32_t next = 0;
+        uint32_t last = 0;
+        auto writeVertex = [&](const uint32_t vertex)
+        {
+            //ől + 1ȂtÔ
+            const auto isNext = vertex == next;
+            if ( !isNext )
+            {
+                const auto delta = static_cast<int32_t>( vertex - last );
+                auto zigzag = ( static_cast<uint32_t>( delta ) << 1 ) ^ static_cast<uint32_t>( delta >> 31 );
+                while ( zigzag >= 0x80 )
+                {
+                    dst.push_back( static_cast<char>( zigzag | 0x80 ) );
+                    zigzag >>= 7;
+                }
+                dst.push_back( static_cast<char>( zigzag ) );
+            }
+            last = vertex;
+            next = std::max<uint32_t>( next, vertex + 1 );
+            return isNext;
+        };
+
+        for ( uint32_t t = 0; t < indexCount / 3; t++ )
+        {
+            const uint32_t triangle[3] = { indexes[t * 3], indexes[t * 3 + 1], indexes[t * 3 + 2] };
+            uint8_t code = MissCode;
+            for ( auto rotation = 0; rotation < 3 && code == MissCode; rotation++ )
+            {
+                const auto edge = fifo.Find( triangle[rotation], triangle[( rotation + 1 ) % 3] );
+                if ( edge >= 0 )
+                {
+                    code = static_cast<uint8_t>( edge << 4 | rotation );
+                    if ( writeVertex( triangle[( rotation + 2 ) % 3] ) )
+                        code |= 0x04;
+                }
+            }
+            if ( code == MissCode )
+            {
+                for ( auto k = 0; k < 3; k++ )
+                {
+                    if ( writeVertex( triangle[k] ) )
+                        code |= static_cast<uint8_t>( 0x04 << k );
+                }
+            }
+            dst[sizeof( uint32_t ) + t] = static_cast<char>( code );
+            fifo.Push( triangle );
+        }
+        return dst;
+    }
+
+    static bool ReadIndexCount(const char* src, const std::size_t size, std::size_t& count)
+    {
+        uint32_t indexCount;
+        if ( size < sizeof( uint32_t ) )
+            return false;
+        std::memcpy( &indexCount, src, sizeof( uint32_t ) );
+        count = indexCount;
+        return indexCount % 3 == 0 && size >= sizeof( uint32_t ) + indexCount / 3;
+    }
+
+    //strideoCg(24)dstɏ(f[^Ăfalse)
+    static bool Decode(const char* src, const std::size_t size, void* dst, const std::size_t stride)
+    {
+        std::size_t indexCount;
+        if ( !ReadIndexCount( src, size, indexCount ) )
+            return false;
+        const auto triangleCount = indexCount / 3;
+        const auto* codes = reinterpret_cast<const uint8_t*>( src ) + sizeof( uint32_t );
+        const auto* data = codes + triangleCount;
+        const auto* end = reinterpret_cast<const uint8_t*>( src ) + size;
+
+        EdgeFifo fifo;
+        uint32_t next = 0;
+        uint32_t last = 0;
+        auto readVertex = [&](const bool isNext, uint32_t& vertex)
+        {
+            if ( isNext )
+                vertex = next;
+            else
+            {
+                uint32_t zigzag = 0;
+                for ( auto shift = 0;; shift += 7 )
+                {
+                    if ( data == end || shift > 28 )
+                        return false;
+                    const auto byte = *data++;
+                    zigzag |= static_cast<uint32_t>( byte & 0x7f ) << shift;
+                    if ( !( byte & 0x80 ) )
+                        break;
+                }
+                vertex = last + ( ( zigzag >> 1 ) ^ ( 0u - ( zigzag & 1 ) ) );
+            }
+            last = vertex;
+            next = std::max<uint32_t>( next, vertex + 1 );
+            return true;
+        };
+
+        auto* out = static_cast<char*>( dst );
+        for ( std::size_t t = 0; t < triangleCount; t++ )
+        {
+            const auto code = codes[t];
+            const auto rotation = code & 0x03;
+            uint32_t triangle[3];
+            if ( rotation == MissCode )
+            {
+                for ( auto k = 0; k < 3; k++ )
+                {
+                    if ( !readVertex( ( code & ( 0x04 << k ) ) != 0, triangle[k] ) )
+                        return false;
+                }
+            }
+            else
+            {
+                const auto& edge = fifo.Get( code >> 4 );
+                triangle[rotation] = edge[0];
+                triangle[( rotation + 1 ) % 3] = edge[1];
+                if ( !readVertex( ( code & 0x04 ) != 0, triangle[( rotation + 2 ) % 3] ) )
+                    return false;
+            }
+            for ( auto k = 0; k < 3; k++ )
+            {
+                if ( stride == sizeof( uint16_t ) )
+                {
+                    const auto index = static_cast<uint16_t>( triangle[k] );
+                    std::memcpy( out + sizeof( uint16_t ) * ( t * 3 + k ), &index, sizeof( uint16_t ) );
+                }
+                else
+                    std::memcpy( out + sizeof( uint32_t ) * ( t * 3 + k ), &triangle[k], sizeof( uint32_t ) );
+            }
+            fifo.Push( triangle );
+        }
+        return true;
+    }
+
+private:
+    static constexpr uint8_t MissCode = 3;
+
+    // Op`̕ӂtɕێFIFO
+    class EdgeFifo
+    {
+    public:
+        //V̈ʒuԂ(-1)
+        int Find(const uint32_t a, const uint32_t b) const
+        {
+            for ( auto i = 0; i < Size; i++ )
+            {
+                const auto& edge = Get( i );
+                if ( edge[0] == a && edge[1] == b )
+                    return i;
+            }
+            return -1;
+        }
+
+        const std::array<uint32_t, 2>& Get(const int index) const
+        {
+            return m_edges[( m_head - 1 - index ) & ( Size - 1 )];
+        }
+
+        void Push(const uint32_t (&triangle)[3])
+        {
+            for ( auto k = 0; k < 3; k++ )
+            {
+                m_edges[m_head & ( Size - 1 )] = { triangle[( k + 1 ) % 3], triangle[k] };
+                m_head++;
+            }
+        }
+
+    private:
+        static constexpr int Size = 16;
+        std::array<std::array<uint32_t, 2>, Size> m_edges{};
+        uint32_t m_head = 0;
+    };
+};
+
+// ėpLZ77nk(Aj[ṼL[Ȃ)
+// [g[N1byte(4biteA4bitv - 4)][e][ItZbg2byte]̕тŁA15ȏ̒255ď
+// Ō̕т̓eŏIBItZbg16bitȂ̂ŃubN64KBPʂňk
+class LzCodec
+{
+public:
+    //dstɎ܂Ȃ菬ȂȂ0Ԃ
+    static std::size_t Compress(const char* src, const std::size_t size, char* dst, const std::size_t capacity)
+    {
+        auto* out = dst;
+        const auto* outEnd = dst + capacity;
+        auto emit = [&](const char* literals, const std::size_t literalCount, const std::size_t offset,
+                        const std::size_t matchLength)
+        {
+            //g[NEEItZbg̍őTCYŐɊmF
+            if ( static_cast<std::size_t>( outEnd - out ) < 1 + literalCount / 255 + 1 + literalCount + 2 + matchLength / 255 + 1 )
+                return false;
+            const auto matchCode = matchLength == 0 ? 0 : matchLength - MinMatch;
+            *out++ = static_cast<char>( std::min<std::size_t>( literalCount, 15 ) << 4 | std::min<std::size_t>( matchCode, 15 ) );
+            out = WriteLength( out, literalCount );
+            std::memcpy( out, literals, literalCount );
+            out += literalCount;
+            if ( matchLength == 0 )
+                return true;
+            *out++ = static_cast<char>( offset & 0xff );
+            *out++ = static_cast<char>( offset >> 8 );
+            out = WriteLength( out, matchCode );
+            return true;
+        };
+
+        std::vector<int32_t> table( std::size_t( 1 ) << HashBits, -1 );
+        std::size_t anchor = 0;
+        std::size_t position = 0;
+        //̓eŏI悤v̒TLastLiteralsO܂łɂ
+        const auto matchLimit = size > LastLiterals ? size - LastLiterals : 0;
+        while ( position + MinMatch <= matchLimit )
+        {
+            const auto sequence = Read32( src + position );
+            auto& entry = table[Hash( sequence )];
+            const auto previous = entry;
+            entry = static_cast<int32_t>( position );
+            const auto candidate = static_cast<std::size_t>( previous );
+            if ( previous < 0 || position - candidate > MaxOffset || Read32( src + candidate ) != sequence )
+            {
+                //vȂԂ͐iޕL
+                position += 1 + ( ( position - anchor ) >> 6 );
+                continue;
+            }
+            auto length = MinMatch;
+            while ( position + length < matchLimit && src[candidate + length] == src[position + length] )
+                length++;
+            if ( !emit( src + anchor, position - anchor, position - candidate, length ) )
+                return 0;
+            position += length;
+            anchor = position;
+        }
+        if ( !emit( src + anchor, size - anchor, 0, 0 ) )
+            return 0;
+        const auto compressedSize = static_cast<std::size_t>( out - dst );
+        return compressedSize < size ? compressedSize : 0;
+    }
+
+    //WJ̃TCYrawSizeƈvȂ(f[^Ă)false
+    static bool Decompress(const char* src, const std::size_t size, char* dst, const std::size_t rawSize)
+    {
+        const auto* in = reinterpret_cast<const uint8_t*>( src );
+        const auto* inEnd = in + size;
+        auto* out = dst;
+        const auto* outEnd = dst + rawSize;
+        while ( in < inEnd )
+        {
+            const auto token = *in++;
+            std::size_t literalCount = token >> 4;
+            if ( !ReadLength( in, inEnd, literalCount ) || literalCount > static_cast<std::size_t>( inEnd - in ) ||
+                literalCount > static_cast<std::size_t>( outEnd - out ) )
+                return false;
+            std::memcpy( out, in, literalCount );
+            in += literalCount;
+            out += literalCount;
+            if ( in == inEnd )
+                break;
+
+            if ( inEnd - in < 2 )
+                return false;
+            const std::size_t offset = in[0] | in[1] << 8;
+            in += 2;
+            std::size_t length = token & 0x0f;
+            if ( offset == 0 || offset > static_cast<std::size_t>( out - dst ) || !ReadLength( in, inEnd, length ) ||
+                length + MinMatch > static_cast<std::size_t>( outEnd - out ) )
+                return false;
+            length += MinMatch;
+            const auto* match = out - offset;
+            if ( offset >= length )
+                std::memcpy( out, match, length );
+            else
+            {
+                //dȂĂꍇ͑O1byteʂČJԂ
+                for ( std::size_t i = 0; i < length; i++ )
+                    out[i] = match[i];
+            }
+            out += length;
+        }
+        return out == outEnd;
+    }
+
+private:
+    static constexpr std::size_t MinMatch = 4;
+    static constexpr std::size_t LastLiterals = 5;
+    static constexpr std::size_t MaxOffset = 0xffff;
+    static constexpr int HashBits = 14;
+
+    static uint32_t Read32(const char* src)
+    {
+        uint32_t value;
+        std::memcpy( &value, src, sizeof( uint32_t ) );
+        return value;
+    }
+
+    static uint32_t Hash(const uint32_t sequence)
+    {
+        return sequence * 2654435761u >> ( 32 - HashBits );
+    }
+
+    //g[NɎ܂Ȃ(15ȏ)255
+    static char* WriteLength(char* out, const std::size_t length)
+    {
+        if ( length < 15 )
+            return out;
+        auto remain = length - 15;
+        for ( ; remain >= 255; remain -= 255 )
+            *out++ = static_cast<char>( 255 );
+        *out++ = static_cast<char>( remain );
+        return out;
+    }
+
+    static bool ReadLength(const uint8_t*& in, const uint8_t* inEnd, std::size_t& length)
+    {
+        if ( length < 15 )
+            return true;
+        uint8_t byte;
+        do
+        {
+            if ( in == inEnd )
+                return false;
+            byte = *in++;
+            length += byte;
+        } while ( byte == 255 );
+        return true;
+    }
+};
+
+// PʃNH[^jI48bitɋl߂(smallest three)
+// Βlő̗vf̔ԍ(2bit)ƕ(1bit)Ac3vf15biti[
+// ̂œWJq-qʂłAvfƂ̕Ԃ̌ʂςȂ
+struct Quaternion48
+{
+    uint16_t data[3];
+
+    //q(x, y, z, w)͐KĂl߂(0ȂPʌ)
+    static Quaternion48 Encode(const float (&q)[4])
+    {
+        float v[4] = { 0, 0, 0, 1 };
+        const auto length = std::sqrt( q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3] );
+        if ( length > 0 )
+        {
+            for ( auto i = 0; i < 4; i++ )
+                v[i] = q[i] / length;
+        }
+        auto largest = 0;
+        for ( auto i = 1; i < 4; i++ )
+        {
+            if ( std::fabs( v[i] ) > std::fabs( v[largest] ) )
+                largest = i;
+        }
+        uint64_t bits = static_cast<uint64_t>( largest ) | static_cast<uint64_t>( v[largest] < 0 ) << 2;
+        auto shift = 3;
+        for ( auto i = 0; i < 4; i++ )
+        {
+            if ( i == largest )
+                continue;
+            //c̗vf[-1/2, 1/2]Ɏ܂
+            const auto unorm = std::min<float>( std::max<float>( v[i] * Sqrt2 * 0.5f + 0.5f, 0.0f ), 1.0f );
+            bits |= static_cast<uint64_t>( std::lround( unorm * ComponentMax ) ) << shift;
+            shift += 15;
+        }
+        Quaternion48 result;
+        for ( auto i = 0; i < 3; i++ )
+            result.data[i] = static_cast<uint16_t>( bits >> ( 16 * i ) );
+        return result;
+    }
+
+    void Decode(float (&q)[4]) const
+    {
+        const auto bits = static_cast<uint64_t>( data[0] ) | static_cast<uint64_t>( data[1] ) << 16 |
+            static_cast<uint64_t>( data[2] ) << 32;
+        const auto largest = static_cast<int>( bits & 0x03 );
+        auto shift = 3;
+        auto sum = 0.0f;
+        for ( auto i = 0; i < 4; i++ )
+        {
+            if ( i == largest )
+                continue;
+            const auto unorm = static_cast<float>( bits >> shift & ComponentMax ) / ComponentMax;
+            q[i] = ( unorm * 2 - 1 ) / Sqrt2;
+            sum += q[i] * q[i];
+            shift += 15;
+        }
+        const auto value = std::sqrt( std::max<float>( 1 - sum, 0.0f ) );
+        q[largest] = bits & 0x04 ? -value : value;
+    }
+
+private:
+    static constexpr float Sqrt2 = 1.41421356f;
+    static constexpr uint32_t ComponentMax = 0x7fff;
+};
+
+//fromto̊ԂtŗvfƂɐ`ԂĐK(nlerpAtofromƓɑĂ)
+inline void NlerpQuaternion(const float* from, const float* to, const float t, float* dst)
+{
+#ifdef UEM_SSE2
+    const auto a = _mm_loadu_ps( from );
+    auto value = _mm_add_ps( a, _mm_mul_ps( _mm_sub_ps( _mm_loadu_ps( to ), a ), _mm_set1_ps( t ) ) );
+    auto dot = _mm_mul_ps( value, value );
+    dot = _mm_add_ps( dot, _mm_shuffle_ps( dot, dot, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+    dot = _mm_add_ps( dot, _mm_shuffle_ps( dot, dot, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+    if ( _mm_cvtss_f32( dot ) > 0 )
+        value = _mm_div_ps( value, _mm_sqrt_ps( dot ) );
+    _mm_storeu_ps( dst, value );
+#else
+    float value[4];
+    for ( auto i = 0; i < 4; i++ )
+        value[i] = from[i] + ( to[i] - from[i] ) * t;
+    //SSE2Ɠɑ
+    const auto dot = ( value[0] * value[0] + value[1] * value[1] ) + ( value[2] * value[2] + value[3] * value[3] );
+    const auto length = dot > 0 ? std::sqrt( dot ) : 1.0f;
+    for ( auto i = 0; i < 4; i++ )
+        dst[i] = value[i] / length;
+#endif
+}
+
+//q𐳋K(0Ȃ炻̂܂܁At = 0nlerpq̂̂𐳋K̂ɂȂ)
+inline void NormalizeQuaternion(float* q)
+{
+    NlerpQuaternion( q, q, 0, q );
+}
+
+//SoẢ](vfƂ̔z)܂Ƃ߂ĐK(0Ȃ炻̂܂)
+inline void NormalizeQuaternions(float* x, float* y, float* z, float* w, const std::size_t count)
+{
+    std::size_t i = 0;
+#ifdef UEM_SSE2
+    const auto zero = _mm_setzero_ps();
+    const auto one = _mm_set1_ps( 1.0f );
+    for ( ; i + 4 <= count; i += 4 )
+    {
+        const auto vx = _mm_loadu_ps( x + i );
+        const auto vy = _mm_loadu_ps( y + i );
+        const auto vz = _mm_loadu_ps( z + i );
+        const auto vw = _mm_loadu_ps( w + i );
+        const auto dot = _mm_add_ps( _mm_add_ps( _mm_mul_ps( vx, vx ), _mm_mul_ps( vy, vy ) ),
+                                     _mm_add_ps( _mm_mul_ps( vz, vz ), _mm_mul_ps( vw, vw ) ) );
+        const auto valid = _mm_cmpgt_ps( dot, zero );
+        const auto scale = _mm_or_ps( _mm_and_ps( valid, _mm_div_ps( one, _mm_sqrt_ps( dot ) ) ), _mm_andnot_ps( valid, one ) );
+        _mm_storeu_ps( x + i, _mm_mul_ps( vx, scale ) );
+        _mm_storeu_ps( y + i, _mm_mul_ps( vy, scale ) );
+        _mm_storeu_ps( z + i, _mm_mul_ps( vz, scale ) );
+        _mm_storeu_ps( w + i, _mm_mul_ps( vw, scale ) );
+    }
+#endif
+    for ( ; i < count; i++ )
+    {
+        const auto dot = ( x[i] * x[i] + y[i] * y[i] ) + ( z[i] * z[i] + w[i] * w[i] );
+        const auto scale = dot > 0 ? 1.0f / std::sqrt( dot ) : 1.0f;
+        x[i] *= scale;
+        y[i] *= scale;
+        z[i] *= scale;
+        w[i] *= scale;
+    }
+}
+
+//HermiteȐ̋ԓ̈ʒusł(n_̒l, n_̌X, I_̒l, I_̌X)̌W
+//X͒l/bȂ̂ŁAX̌Wɂ͋Ԃ̒dt|Ă
+struct HermiteBasis
+{
+    float p0, m0, p1, m1;
+
+    float Evaluate(const float value0, const float slope0, const float value1, const float slope1) const
+    {
+        return p0 * value0 + m0 * slope0 + p1 * value1 + m1 * slope1;
+    }
+};
+
+inline HermiteBasis GetHermiteBasis(const float s, const float dt)
+{
+    const auto s2 = s * s;
+    const auto s3 = s2 * s;
+    return HermiteBasis{ 2 * s3 - 3 * s2 + 1, ( s3 - 2 * s2 + s ) * dt, 3 * s2 - 2 * s3, ( s3 - s2 ) * dt };
+}
+
+//ԓ̈ʒusł̌X̌W(GetHermiteBasisԂŔ)
+inline HermiteBasis GetHermiteSlopeBasis(const float s, const float dt)
+{
+    const auto s2 = s * s;
+    return HermiteBasis{ ( 6 * s2 - 6 * s ) / dt, 3 * s2 - 4 * s + 1, ( 6 * s - 6 * s2 ) / dt, 3 * s2 - 2 * s };
+}
+
+// ǂݍݎɒ_f[^񂾃oCg𐔂JE^
+// [_[͒_obt@֏ނтɃbVPʂŉZAt@CQƂ邾View͉ZȂ
+// ǂݍ񂾒_̑oCgƈvΊe_̃Rs[͈xAViewȂ0ɂȂ
+class CopyCounter
+{
+public:
+    static void AddVertexBytes(const std::size_t bytes)
+    {
+        GetVertexBytesCounter().fetch_add( bytes, std::memory_order_relaxed );
+    }
+
+    static uint64_t GetVertexBytes()
+    {
+        return GetVertexBytesCounter().load();
+    }
+
+    static void Reset()
+    {
+        GetVertexBytesCounter() = 0;
+    }
+
+private:
+    static std::atomic<uint64_t>& GetVertexBytesCounter()
+    {
+        static std::atomic<uint64_t> vertexBytes( 0 );
+        return vertexBytes;
+    }
+};
+
+//(2byte)+̓ǂݍ
+//str̊mۍςݗ̈ėp
+template <class Stream, class String>
+void ReadString(Stream& fileStream, String& str)
+{
+    uint16_t count;
+    fileStream.Read( &count, sizeof( uint16_t ) );
+    str.resize( count );
+    if ( count != 0 )
+        fileStream.Read( &str[0], sizeof( char ) * count );
+}
+
+template <class Stream>
+std::string ReadString(Stream& fileStream)
+{
+    std::string str;
+    ReadString( fileStream, str );
+    return str;
+}
+
+//}eA̓ǂݍ
+template <class Stream>
+Material LoadMaterialBinary(Stream& fileStream, const std::string& directory,
+                            std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+{
+    Material material( resource );
+    ReadString( fileStream, material.name );
+
+    uint16_t colorCount;
+    fileStream.Read( &colorCount, sizeof( uint16_t ) );
+    for ( auto i = 0; i < colorCount; i++ )
+    {
+        const auto propertyName = ReadString( fileStream );
+        Float4 color;
+        fileStream.Read( &color, sizeof( float ) * 4 );
+        material.AddColor( propertyName, color );
+    }
+
+    uint16_t textureCount;
+    fileStream.Read( &textureCount, sizeof( uint16_t ) );
+    for ( auto i = 0; i < textureCount; i++ )
+    {
+        const auto propertyName = ReadString( fileStream );
+        const auto textureName = ReadString( fileStream );
+        if ( textureName.empty() )
+        {
+            material.AddTexture( propertyName, "null" );
+            continue;
+        }
+        material.AddTexture( propertyName, directory + "/" + textureName );
+    }
+    return material;
+}
+
+//}eA̓ǂݍ(ASCII)
+inline Material LoadMaterialAscii(AsciiTokenizer& tokenizer, const std::string& directory,
+                                  std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+{
+    Material material( resource );
+    material.name = tokenizer.ReadString();
+    const auto colorCount = tokenizer.Read<int>();
+    for ( auto i = 0; i < colorCount; i++ )
+    {
+        const auto propertyName = tokenizer.ReadString();
+        Float4 color;
+        tokenizer.Read( &color.x, 4 );
+        material.AddColor( propertyName, color );
+    }
+
+    const auto textureCount = tokenizer.Read<int>();
+    for ( auto i = 0; i < textureCount; i++ )
+    {
+        const auto propertyName = tokenizer.ReadString();
+        const auto textureName = tokenizer.ReadString();
+        material.AddTexture( propertyName, directory + "/" + textureName );
+    }
+    return material;
+}
+
+//tokensPerRecordg[N̃R[hrecordCountǂݍ
+//ꍇ̓R[hPʂ̉ɕĕɕϊAǂݍ݈ʒuubN̒֐i߂
+template <class F>
+void ReadAsciiRecords(AsciiTokenizer& tokenizer, const std::size_t recordCount, const std::size_t tokensPerRecord,
+                      const AsciiTokenIndex* tokenIndex, ThreadPool* threadPool, F&& readRecord)
+{
+    constexpr std::size_t chunkTokenCount = 64 * 1024;
+    const auto chunkRecordCount = ( chunkTokenCount + tokensPerRecord - 1 ) / tokensPerRecord;
+    if ( tokenIndex == nullptr || threadPool == nullptr || recordCount <= chunkRecordCount )
+    {
+        for ( std::size_t i = 0; i < recordCount; i++ )
+            readRecord( tokenizer, i );
+        return;
+    }
+
+    const auto firstToken = tokenIndex->IndexOf( tokenizer.GetPosition() );
+    const auto chunkCount = ( recordCount + chunkRecordCount - 1 ) / chunkRecordCount;
+    threadPool->ParallelFor( chunkCount, [&](const std::size_t chunk)
+    {
+        const auto begin = chunk * chunkRecordCount;
+        const auto last = begin + chunkRecordCount < recordCount ? begin + chunkRecordCount : recordCount;
+        AsciiTokenizer chunkTokenizer( tokenizer );
+        chunkTokenizer.Seek( tokenIndex->Find( firstToken + begin * tokensPerRecord ) );
+        for ( auto i = begin; i < last; i++ )
+            readRecord( chunkTokenizer, i );
+    } );
+    tokenizer.Seek( tokenIndex->Find( firstToken + recordCount * tokensPerRecord ) );
+}
+
+//̃}eA΂̔ԍAΒǉĐVԍԂ
+inline int RegisterMaterial(std::vector<Material>& materials, Material&& material)
+{
+    auto materialNo = -1;
+    for ( auto j = 0; j < static_cast<int>( materials.size() ); j++ )
+    {
+        if ( materials[j].name == material.name )
+            materialNo = j;
+    }
+    if ( materialNo == -1 )
+    {
+        materialNo = static_cast<int>( materials.size() );
+        materials.push_back( std::move( material ) );
+    }
+    return materialNo;
+}
+
+//nbVTransform߂̕\(Transform͕\Ɠresourcemۂ)
+using TransformMap = std::pmr::unordered_map<std::size_t, ResourcePtr<Transform>>;
+
+//f̊Kw\ǂݍ
+template <class Stream>
+void LoadHierarchyBinary(Stream& fileStream, Transform* root, TransformMap& transformMap)
+{
+    auto active = root;
+    auto transformCount = 0;
+    {
+        short tmpCount;
+        fileStream.Read( &tmpCount, sizeof( short ) );
+        active->m_name.resize( tmpCount );
+        fileStream.Read( &active->m_name[0], sizeof( char ) * tmpCount );
+        transformCount++;
+        active->m_hash = std::hash<std::string_view>()( active->m_name );
+        fileStream.Read( &active->m_position, sizeof( float ) * 3 );
+        Float3 euler;
+        fileStream.Read( &euler, sizeof( float ) * 3 );
+        active->m_rotation = MakeQuaternion( euler );
+        fileStream.Read( &active->m_scale, sizeof( float ) * 3 );
+    }
+    while ( transformCount != 0 )
+    {
+        short tmpCount;
+        fileStream.Read( &tmpCount, sizeof( short ) );
+        if ( tmpCount == -1 )
+        {
+            transformCount--;
+            active = active->m_parent;
+            continue;
+        }
+        transformCount++;
+
+        //O̓A[i̕ɒړǂݍ(std::hash<std::string>ƓlɂȂ)
+        auto newTrans = MakeResourcePtr<Transform>( transformMap.get_allocator().resource() );
+        newTrans->m_name.resize( tmpCount );
+        fileStream.Read( &newTrans->m_name[0], sizeof( char ) * tmpCount );
+        newTrans->m_hash = std::hash<std::string_view>()( newTrans->m_name );
+
+        fileStream.Read( &newTrans->m_position, sizeof( float ) * 3 );
+        Float3 euler;
+        fileStream.Read( &euler, sizeof( float ) * 3 );
+        newTrans->m_rotation = MakeQuaternion( euler );
+        fileStream.Read( &newTrans->m_scale, sizeof( float ) * 3 );
+        newTrans->m_parent = active;
+        active->m_child.push_back( newTrans.get() );
+        active = newTrans.get();
+        transformMap.insert( std::make_pair( newTrans->m_hash, std::move( newTrans ) ) );
+    }
+}
+
+//x[X|[Yǂݍ
+//name͓ǂݍݗp̍Ɨ̈
+template <class Stream>
+std::pair<Matrix, Transform*> LoadBindPoseBinary(Stream& fileStream, Transform* root, std::string& name)
+{
+    ReadString( fileStream, name );
+    Matrix tmp;
+    fileStream.Read( &tmp, sizeof( float ) * 16 );
+    return std::make_pair( Transpose( tmp ), root->Find( name ) );
+}
+
+//bVItZbge[u
+//t@C uint64_t offsets[modelCount], uint32_t modelCount, uint32_t MeshOffsetTableMagic ̏Œǉ
+//[_[͖܂œǂ܂Ȃ̂Ńe[ut̃t@Ĉ܂ܓǂݍ߂
+static constexpr uint32_t MeshOffsetTableMagic = 0x544F4D55; //"UMOT"
+
+inline bool ReadMeshOffsetTable(const char* data, const std::size_t size, const uint16_t modelCount,
+                                std::vector<uint64_t>& offsets)
+{
+    const auto footerSize = sizeof( uint32_t ) * 2;
+    if ( size < footerSize )
+        return false;
+    uint32_t count;
+    uint32_t magic;
+    std::memcpy( &count, data + size - footerSize, sizeof( uint32_t ) );
+    std::memcpy( &magic, data + size - sizeof( uint32_t ), sizeof( uint32_t ) );
+    if ( magic != MeshOffsetTableMagic || count != modelCount )
+        return false;
+    const auto tableSize = sizeof( uint64_t ) * count;
+    if ( size < footerSize + tableSize )
+        return false;
+    offsets.resize( count );
+    std::memcpy( offsets.data(), data + size - footerSize - tableSize, tableSize );
+    for ( auto offset : offsets )
+    {
+        if ( offset >= size - footerSize - tableSize )
+            return false;
+    }
+    return true;
+}
+
+inline void SkipString(MemoryStream& stream)
+{
+    uint16_t count;
+    stream.Read( &count, sizeof( uint16_t ) );
+    stream.Skip( count );
+}
+
+inline void SkipHierarchyBinary(MemoryStream& stream)
+{
+    auto transformCount = 0;
+    do
+    {
+        short tmpCount;
+        stream.Read( &tmpCount, sizeof( short ) );
+        if ( tmpCount == -1 )
+        {
+            transformCount--;
+            continue;
+        }
+        transformCount++;
+        stream.Skip( tmpCount + sizeof( float ) * 9 );
+    }
+    while ( transformCount != 0 );
+}
+
+inline void SkipMaterialBinary(MemoryStream& stream)
+{
+    SkipString( stream );
+    uint16_t colorCount;
+    stream.Read( &colorCount, sizeof( uint16_t ) );
+    for ( auto i = 0; i < colorCount; i++ )
+    {
+        SkipString( stream );
+        stream.Skip( sizeof( float ) * 4 );
+    }
+    uint16_t textureCount;
+    stream.Read( &textureCount, sizeof( uint16_t ) );
+    for ( auto i = 0; i < textureCount; i++ )
+    {
+        SkipString( stream );
+        SkipString( stream );
+    }
+}
+
+//Rei`(o[W2)
+//ContainerHeader, ContainerSection[sectionCount]̌ɊeZNVׂ
+//ZNV16byteEɑ̂ŁA_ƃCfbNX̓}bv܂܎QƂGPUւ̓]ł
+//`̃t@C͐擪4byte}WbNƈvȂƂŌ
+static constexpr uint32_t ContainerMagic = 0x434D4555; //"UEMC"
+static constexpr uint16_t ContainerVersion = 2;
+static constexpr std::size_t ContainerAlignment = 16;
+
+enum class ContainerKind : uint16_t
+{
+    Model = 0, //.umb
+    SkinnedModel = 1, //.usb
+    Animation = 2, //.usab
+};
+
+enum class ContainerSectionType : uint32_t
+{
+    Hierarchy = 1, //Kw\(`Ɠ)
+    ModelInfo = 2, //short vertexFormat, uint16_t modelCount
+    Vertices = 3, //_̔z
+    Indexes = 4, //uint32_t̃CfbNX̔z
+    BindPoses = 5, //uint16_t basePoseCount, (O, float[16]) * basePoseCount
+    Material = 6, //}eA(`Ɠ)
+    AnimationInfo = 7, //uint32_t animationCount
+    Animation = 8, //Aj[V1(`Ɠ)
+    VertexEncoding = 9, //uint32_t EncodeFlg̑gݍ킹(ΈkȂ)
+    Bounds = 10, //bVBounds(ʒu̗ʎq̊)
+    ShortIndexes = 11, //_ShortIndexVertexLimitȉ̃bV16bitCfbNX
+    CompressedVertices = 12, //VertexStreamCodecŉtkVertices
+    CompressedIndexes = 13, //IndexStreamCodecŉtkIndexes(WJ͒̕_Ō܂)
+    ClipInfo = 14, //RpNg`̃NbvClipInfo
+    ClipBone = 15, //RpNg`̃{[1{(O, (uint32_t keyCount, gbÑf[^) * ClipTrackCount)
+    PositionStream = 16, //_̈ʒu(float x3)̔z
+    AttributeStream = 17, //_̈ʒuBoneIndex & BoneWeightȊO̗vf̔z
+    SkinStream = 18, //_BoneIndex & BoneWeight(VertexSkin)̔z
+    MeshBounds = 19, //JOp̃bV̋E(MeshBounds)
+    BoneBounds = 20, //x[X|[YƓт̃oChԂBounds̔z
+    HermiteAnimation = 21, //Aj[V1(O, (uint32_t keyCount, times, keys, inSlopes, outSlopes) * 10)
+};
+
+//SkinStreamZNV1_
+struct VertexSkin
+{
+    uint32_t boneIndex[4];
+    float boneWeight[4];
+};
+
+//ZNV̎ނɗĂƃf[^ubNƂLzCodecňkĂ邱Ƃ
+//ǂݍݎ͓WJĂtOOނƂĈ
+static constexpr uint32_t BlockCompressedSectionFlag = 0x80000000;
+//ubN̍őTCY(ubNƂɓƗēWJł)
+static constexpr std::size_t ContainerBlockSize = 64 * 1024;
+
+struct ContainerHeader
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t kind;
+    uint32_t sectionCount;
+    uint32_t reserved;
+    uint64_t fileSize;
+};
+
+//index̓bVAj[V̔ԍ
+struct ContainerSection
+{
+    uint32_t type;
+    uint32_t index;
+    uint64_t offset;
+    uint64_t size;
+};
+
+inline bool IsContainerData(const char* data, const std::size_t size)
+{
+    return size >= sizeof( uint32_t ) && std::memcmp( data, &ContainerMagic, sizeof( uint32_t ) ) == 0;
+}
+
+//ZNVt@CɑO珇ɕсA_ƃCfbNXĂ邩mF
+inline bool CheckContainerSections(const ContainerHeader& header, const std::vector<ContainerSection>& sections)
+{
+    uint64_t end = sizeof( ContainerHeader ) + sizeof( ContainerSection ) * sections.size();
+    for ( const auto& section : sections )
+    {
+        if ( section.offset < end || section.size > header.fileSize || section.offset > header.fileSize - section.size )
+            return false;
+        const auto type = static_cast<ContainerSectionType>( section.type );
+        if ( ( type == ContainerSectionType::Vertices || type == ContainerSectionType::Indexes ||
+                type == ContainerSectionType::ShortIndexes || type == ContainerSectionType::PositionStream ||
+                type == ContainerSectionType::AttributeStream || type == ContainerSectionType::SkinStream ) &&
+            section.offset % ContainerAlignment != 0 )
+            return false;
+        end = section.offset + section.size;
+    }
+    return true;
+}
+
+//ubNkZNV̐擪
+//̌uint32_t i[TCY[blockCount]ƊeubÑf[^
+//i[TCYWJ̃TCYƓubN͈kɂ̂܂܊i[Ă
+struct BlockSectionHeader
+{
+    uint64_t rawSize;
+    uint32_t blockSize;
+    uint32_t blockCount;
+};
+
+//ubNkZNV1ubN
+struct CompressedBlock
+{
+    const char* data;
+    std::size_t storedSize;
+    std::size_t rawOffset; //WJ̃ZNV̈ʒu
+    std::size_t rawSize;
+};
+
+//blockSizeƂɈk(Ŝ菬ȂȂ΋Ԃ)
+inline std::vector<char> CompressBlocks(const char* data, const std::size_t size,
+                                        const std::size_t blockSize = ContainerBlockSize)
+{
+    std::vector<char> dst;
+    if ( size == 0 || blockSize == 0 || blockSize > ContainerBlockSize )
+        return dst;
+    const auto blockCount = ( size + blockSize - 1 ) / blockSize;
+    const BlockSectionHeader header{ size, static_cast<uint32_t>( blockSize ), static_cast<uint32_t>( blockCount ) };
+    dst.resize( sizeof( BlockSectionHeader ) + sizeof( uint32_t ) * blockCount );
+    std::memcpy( dst.data(), &header, sizeof( BlockSectionHeader ) );
+    std::vector<char> block( blockSize );
+    for ( std::size_t i = 0; i < blockCount; i++ )
+    {
+        const auto* src = data + blockSize * i;
+        const auto rawSize = std::min<std::size_t>( blockSize, size - blockSize * i );
+        auto storedSize = static_cast<uint32_t>( LzCodec::Compress( src, rawSize, block.data(), block.size() ) );
+        if ( storedSize == 0 )
+        {
+            //ȂȂubN͂̂܂܊i[
+            storedSize = static_cast<uint32_t>( rawSize );
+            dst.insert( dst.end(), src, src + rawSize );
+        }
+        else
+            dst.insert( dst.end(), block.data(), block.data() + storedSize );
+        std::memcpy( dst.data() + sizeof( BlockSectionHeader ) + sizeof( uint32_t ) * i, &storedSize, sizeof( uint32_t ) );
+    }
+    if ( dst.size() >= size )
+        dst.clear();
+    return dst;
+}
+
+//ubNkZNVmFAeubNblocksɒǉ
+inline bool ReadCompressedBlocks(const char* data, const std::size_t size, uint64_t& rawSize,
+                                 std::vector<CompressedBlock>& blocks)
+{
+    BlockSectionHeader header;
+    if ( size < sizeof( BlockSectionHeader ) )
+        return false;
+    std::memcpy( &header, data, sizeof( BlockSectionHeader ) );
+    const uint64_t blockSize = header.blockSize;
+    if ( blockSize == 0 || blockSize > ContainerBlockSize ||
+        header.blockCount > ( size - sizeof( BlockSectionHeader ) ) / sizeof( uint32_t ) ||
+        header.rawSize > blockSize * header.blockCount ||
+        ( header.blockCount != 0 && header.rawSize <= blockSize * ( header.blockCount - 1 ) ) )
+        return false;
+    const auto* table = data + sizeof( BlockSectionHeader );
+    const auto* block = table + sizeof( uint32_t ) * header.blockCount;
+    const auto* end = data + size;
+    for ( uint32_t i = 0; i < header.blockCount; i++ )
+    {
+        uint32_t storedSize;
+        std::memcpy( &storedSize, table + sizeof( uint32_t ) * i, sizeof( uint32_t ) );
+        const auto blockRawSize = static_cast<std::size_t>( std::min<uint64_t>( blockSize, header.rawSize - blockSize * i ) );
+        if ( storedSize > blockRawSize || storedSize > static_cast<std::size_t>( end - block ) )
+            return false;
+        blocks.push_back( CompressedBlock{
+            block, storedSize, static_cast<std::size_t>( blockSize * i ), blockRawSize
+        } );
+        block += storedSize;
+    }
+    rawSize = header.rawSize;
+    return true;
+}
+
+//ubNWJ̃ZNV̐擪section̒ɓWJ
+inline bool DecompressBlock(const CompressedBlock& block, char* section)
+{
+    if ( block.storedSize == block.rawSize )
+    {
+        std::memcpy( section + block.rawOffset, block.data, block.rawSize );
+        return true;
+    }
+    return LzCodec::Decompress( block.data, block.storedSize, section + block.rawOffset, block.rawSize );
+}
+
+//wb_[ƃZNVe[uǂݍŊmF
+template <class Stream>
+bool ReadContainerHeader(Stream& fileStream, const ContainerKind kind, std::vector<ContainerSection>& sections)
+{
+    ContainerHeader header;
+    fileStream.Read( &header, sizeof( ContainerHeader ) );
+    if ( header.magic != ContainerMagic || header.version != ContainerVersion ||
+        header.kind != static_cast<uint16_t>( kind ) )
+        return false;
+    if ( header.sectionCount > header.fileSize / sizeof( ContainerSection ) )
+        return false;
+    sections.resize( header.sectionCount );
+    if ( header.sectionCount != 0 )
+        fileStream.Read( sections.data(), static_cast<int>( sizeof( ContainerSection ) * header.sectionCount ) );
+    return CheckContainerSections( header, sections );
+}
+
+// `ƃRei`邽߂̃Xg[
+// 擪4byteǂ݂Ă㑱Readŉ߂ĕԂ̂ŁA`͂̂܂ܓǂݍ߂
+// ǂݍ񂾈ʒu𐔂ĂAZNV̐擪܂őO֓ǂݔ΂
+// ubNkꂽZNV̓ZNVPʂœWJAWJf[^ReadŕԂ
+template <class Stream>
+class ContainerStream
+{
+public:
+    explicit ContainerStream(Stream& stream)
+        : m_stream( stream )
+    {
+    }
+
+    bool IsContainer()
+    {
+        m_stream.Read( m_peek, sizeof( m_peek ) );
+        m_peekSize = sizeof( m_peek );
+        return IsContainerData( m_peek, sizeof( m_peek ) );
+    }
+
+    void Read(void* data, const int size)
+    {
+        auto* dst = static_cast<char*>( data );
+        auto remain = static_cast<std::size_t>( size );
+        //WJZNVǂłԂ̓t@C̈ʒui߂Ȃ
+        if ( m_sectionOffset < m_section.size() )
+        {
+            const auto count = std::min<std::size_t>( remain, m_section.size() - m_sectionOffset );
+            std::memcpy( dst, &m_section[m_sectionOffset], count );
+            m_sectionOffset += count;
+            dst += count;
+            remain -= count;
+        }
+        m_position += remain;
+        if ( m_peekOffset < m_peekSize )
+        {
+            const auto count = std::min<std::size_t>( remain, m_peekSize - m_peekOffset );
+            std::memcpy( dst, &m_peek[m_peekOffset], count );
+            m_peekOffset += count;
+            dst += count;
+            remain -= count;
+        }
+        if ( remain != 0 )
+            m_stream.Read( dst, static_cast<int>( remain ) );
+    }
+
+    //position܂œǂݔ΂(ւ͖߂Ȃ)
+    bool Seek(const uint64_t position)
+    {
+        if ( position < m_position )
+            return false;
+        char skip[256];
+        while ( m_position < position )
+            Read( skip, static_cast<int>( std::min<uint64_t>( sizeof( skip ), position - m_position ) ) );
+        return true;
+    }
+
+    //entrỹZNV̐擪܂œǂݔ΂
+    //ubNkĂΓWJĂAsectionɂ̓tOOނƓWJ̃TCYԂ
+    bool BeginSection(const ContainerSection& entry, ContainerSection& section)
+    {
+        m_section.clear();
+        m_sectionOffset = 0;
+        section = entry;
+        if ( !Seek( entry.offset ) )
+            return false;
+        if ( !( entry.type & BlockCompressedSectionFlag ) )
+            return true;
+        m_payload.resize( static_cast<std::size_t>( entry.size ) );
+        if ( !m_payload.empty() )
+            Read( m_payload.data(), static_cast<int>( m_payload.size() ) );
+        uint64_t rawSize;
+        m_blocks.clear();
+        if ( !ReadCompressedBlocks( m_payload.data(), m_payload.size(), rawSize, m_blocks ) )
+            return false;
+        m_section.resize( static_cast<std::size_t>( rawSize ) );
+        for ( const auto& block : m_blocks )
+        {
+            if ( !DecompressBlock( block, m_section.data() ) )
+                return false;
+        }
+        section.type = entry.type & ~BlockCompressedSectionFlag;
+        section.size = rawSize;
+        return true;
+    }
+
+private:
+    Stream& m_stream;
+    char m_peek[sizeof( uint32_t )]{};
+    std::size_t m_peekSize = 0;
+    std::size_t m_peekOffset = 0;
+    uint64_t m_position = 0;
+    std::vector<char> m_payload; //kꂽZNV̓ǂݍݐ
+    std::vector<CompressedBlock> m_blocks;
+    std::vector<char> m_section; //WJZNV
+    std::size_t m_sectionOffset = 0;
+};
+
+// (}bvt@C)̃ReiZNVPʂŎQƂ
+// ނƔԍCӂ̃ZNV֒ڈړł
+// ubNkꂽZNV͓ǂݍݎɓWJAȍ~͈kĂȂZNVƓ悤Ɉ
+class ContainerView
+{
+public:
+    //threadPoolΑSẴZNṼubNɓWJ
+    //WJresourcemۂ(ContainerViewg)
+    bool Load(const char* data, const std::size_t size, const ContainerKind kind, ThreadPool* threadPool = nullptr,
+              std::pmr::memory_resource* resource = nullptr)
+    {
+        m_sections.clear();
+        m_sectionDatas.clear();
+        m_sectionMap.clear();
+        if ( size < sizeof( ContainerHeader ) || !IsContainerData( data, size ) )
+            return false;
+        ContainerHeader header;
+        std::memcpy( &header, data, sizeof( ContainerHeader ) );
+        if ( header.fileSize > size )
+            return false;
+        MemoryStream stream( data, size );
+        if ( !ReadContainerHeader( stream, kind, m_sections ) )
+            return false;
+        if ( !DecompressSections( data, threadPool, resource ) )
+            return false;
+        for ( std::size_t i = 0; i < m_sections.size(); i++ )
+            m_sectionMap.emplace( GetKey( static_cast<ContainerSectionType>( m_sections[i].type ), m_sections[i].index ), i );
+        return true;
+    }
+
+    const ContainerSection* Find(const ContainerSectionType type, const uint32_t index) const
+    {
+        const auto itr = m_sectionMap.find( GetKey( type, index ) );
+        return itr == m_sectionMap.end() ? nullptr : &m_sections[itr->second];
+    }
+
+    //sectionFindŕԂ
+    const char* GetData(const ContainerSection& section) const
+    {
+        assert( &section >= m_sections.data() && &section < m_sections.data() + m_sections.size() );
+        return m_sectionDatas[&section - m_sections.data()];
+    }
+
+    MemoryStream GetStream(const ContainerSection& section) const
+    {
+        return MemoryStream( GetData( section ), section.size );
+    }
+
+    //ŒTCỸZNVǂݍ(false)
+    template <class T>
+    bool ReadSection(const ContainerSectionType type, const uint32_t index, T& value) const
+    {
+        const auto* section = Find( type, index );
+        if ( section == nullptr || section->size < sizeof( T ) )
+            return false;
+        std::memcpy( &value, GetData( *section ), sizeof( T ) );
+        return true;
+    }
+
+private:
+    static uint64_t GetKey(const ContainerSectionType type, const uint32_t index)
+    {
+        return static_cast<uint64_t>( type ) << 32 | index;
+    }
+
+    //ubNkꂽZNVWJAZNV̎ނƃTCYWĴ̂ɒu
+    bool DecompressSections(const char* data, ThreadPool* threadPool, std::pmr::memory_resource* resource)
+    {
+        std::vector<CompressedBlock> blocks;
+        std::vector<char*> blockSections;
+        m_sectionDatas.resize( m_sections.size() );
+        for ( std::size_t i = 0; i < m_sections.size(); i++ )
+        {
+            auto& section = m_sections[i];
+            m_sectionDatas[i] = data + section.offset;
+            if ( !( section.type & BlockCompressedSectionFlag ) )
+                continue;
+            uint64_t rawSize;
+            if ( !ReadCompressedBlocks( data + section.offset, static_cast<std::size_t>( section.size ), rawSize, blocks ) )
+                return false;
+            if ( resource == nullptr )
+            {
+                if ( !m_storage )
+                    m_storage = std::make_unique<std::pmr::monotonic_buffer_resource>();
+                resource = m_storage.get();
+            }
+            auto* sectionData = static_cast<char*>( resource->allocate( static_cast<std::size_t>( rawSize ), ContainerAlignment ) );
+            blockSections.resize( blocks.size(), sectionData );
+            m_sectionDatas[i] = sectionData;
+            section.type &= ~BlockCompressedSectionFlag;
+            section.size = rawSize;
+        }
+
+        std::atomic<bool> succeeded( true );
+        auto decompress = [&](const std::size_t i)
+        {
+            if ( !DecompressBlock( blocks[i], blockSections[i] ) )
+                succeeded = false;
+        };
+        if ( threadPool != nullptr )
+            threadPool->ParallelFor( blocks.size(), decompress );
+        else
+        {
+            for ( std::size_t i = 0; i < blocks.size(); i++ )
+                decompress( i );
+        }
+        return succeeded;
+    }
+
+    std::vector<ContainerSection> m_sections;
+    std::vector<const char*> m_sectionDatas;
+    std::unordered_map<uint64_t, std::size_t> m_sectionMap;
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> m_storage;
+};
+
+//ZNṼf[^w|C^Ԃ
+//̃Xg[̓Rs[ɂ̂܂܎wAȊOscratch֓ǂݍ
+template <class Stream>
+const char* ReadSectionData(Stream& fileStream, const std::size_t size, std::vector<char>& scratch)
+{
+    scratch.resize( size );
+    if ( size != 0 )
+        fileStream.Read( scratch.data(), static_cast<int>( size ) );
+    return scratch.data();
+}
+
+inline const char* ReadSectionData(MemoryStream& fileStream, const std::size_t size, std::vector<char>&)
+{
+    return fileStream.Map( size );
+}
+
+//count32bit̃CfbNXǂݍ݁A_Ȃ16bitɋl߂
+template <class Stream>
+void ReadIndexes(Stream& fileStream, const std::size_t count, const std::size_t vertexCount, IndexArray& indexes)
+{
+    if ( GetIndexStride( vertexCount ) == sizeof( uint32_t ) )
+    {
+        indexes.Resize( count, vertexCount );
+        if ( count != 0 )
+            fileStream.Read( indexes.GetBytes(), static_cast<int>( sizeof( uint32_t ) * count ) );
+        return;
+    }
+    std::vector<char> scratch;
+    indexes.Assign( ReadSectionData( fileStream, sizeof( uint32_t ) * count, scratch ), count, vertexCount );
+}
+
+//kꂽ_̃ZNVWJ(_̓ZNṼTCY狁߂)
+template <class Stream, class Vector>
+bool DecodeVertexSection(Stream& fileStream, const ContainerSection& section, const VertexCodec& codec,
+                         const Bounds& bounds, Vector& vertexDatas)
+{
+    using X = typename Vector::value_type;
+    const auto packedSize = codec.GetPackedVertexSize();
+    if ( packedSize == 0 || section.size % packedSize != 0 || codec.GetVertexSize() != sizeof( X ) )
+        return false;
+    const auto count = static_cast<std::size_t>( section.size / packedSize );
+    std::vector<char> scratch;
+    const auto* packed = ReadSectionData( fileStream, static_cast<std::size_t>( section.size ), scratch );
+    vertexDatas.resize( count );
+    codec.Decode( packed, count, bounds, vertexDatas.data() );
+    CopyCounter::AddVertexBytes( sizeof( X ) * count );
+    return true;
+}
+
+//tkꂽ_̃ZNVWJ(codec΂Ɍ̕тɕϊ)
+template <class Stream, class Vector>
+bool DecompressVertexSection(Stream& fileStream, const ContainerSection& section, const VertexCodec* codec,
+                             const Bounds& bounds, Vector& vertexDatas)
+{
+    using X = typename Vector::value_type;
+    const auto size = static_cast<std::size_t>( section.size );
+    std::vector<char> scratch;
+    const auto* src = ReadSectionData( fileStream, size, scratch );
+    std::size_t count, vertexSize;
+    if ( !VertexStreamCodec::ReadHeader( src, size, count, vertexSize ) )
+        return false;
+    if ( codec == nullptr )
+    {
+        if ( vertexSize != sizeof( X ) )
+            return false;
+        vertexDatas.resize( count );
+        if ( !VertexStreamCodec::Decode( src, size, vertexDatas.data(), sizeof( X ) * count ) )
+            return false;
+    }
+    else
+    {
+        if ( vertexSize != codec->GetPackedVertexSize() || codec->GetVertexSize() != sizeof( X ) )
+            return false;
+        std::vector<char> packed( vertexSize * count );
+        if ( !VertexStreamCodec::Decode( src, size, packed.data(), packed.size() ) )
+            return false;
+        vertexDatas.resize( count );
+        codec->Decode( packed.data(), count, bounds, vertexDatas.data() );
+    }
+    CopyCounter::AddVertexBytes( sizeof( X ) * count );
+    return true;
+}
+
+//tkꂽCfbNX̃ZNV𒸓_ɍœWJ
+template <class Stream>
+bool DecompressIndexSection(Stream& fileStream, const ContainerSection& section, const std::size_t vertexCount,
+                            IndexArray& indexes)
+{
+    const auto size = static_cast<std::size_t>( section.size );
+    std::vector<char> scratch;
+    const auto* src = ReadSectionData( fileStream, size, scratch );
+    std::size_t count;
+    if ( !IndexStreamCodec::ReadIndexCount( src, size, count ) )
+        return false;
+    indexes.Resize( count, vertexCount );
+    return IndexStreamCodec::Decode( src, size, indexes.GetBytes(), indexes.GetStride() );
+}
+
+//tkꂽ_A[iɓWJăr[w(k̕т̂܂)
+template <class X>
+bool DecompressVertexView(const ContainerView& container, const ContainerSection& section,
+                          std::pmr::memory_resource* resource, ArrayView<X>& vertexDatas)
+{
+    const auto* src = container.GetData( section );
+    const auto size = static_cast<std::size_t>( section.size );
+    std::size_t count, vertexSize;
+    if ( !VertexStreamCodec::ReadHeader( src, size, count, vertexSize ) || vertexSize != sizeof( X ) )
+        return false;
+    auto* vertices = static_cast<X*>( resource->allocate( sizeof( X ) * count, ContainerAlignment ) );
+    if ( !VertexStreamCodec::Decode( src, size, vertices, sizeof( X ) * count ) )
+        return false;
+    vertexDatas.ptr = vertices;
+    vertexDatas.count = count;
+    CopyCounter::AddVertexBytes( sizeof( X ) * count );
+    return true;
+}
+
+//tkꂽCfbNXA[iɓWJăr[w
+inline bool DecompressIndexView(const ContainerView& container, const ContainerSection& section,
+                                const std::size_t vertexCount, std::pmr::memory_resource* resource, IndexView& indexes)
+{
+    const auto* src = container.GetData( section );
+    const auto size = static_cast<std::size_t>( section.size );
+    std::size_t count;
+    if ( !IndexStreamCodec::ReadIndexCount( src, size, count ) )
+        return false;
+    const auto stride = GetIndexStride( vertexCount );
+    auto* data = resource->allocate( stride * count, ContainerAlignment );
+    if ( !IndexStreamCodec::Decode( src, size, data, stride ) )
+        return false;
+    indexes = IndexView{ data, count, stride };
+    return true;
+}
+
+//_Xg[̃ZNVǂݍ(stride1_̃oCg)
+template <class Stream, class T>
+bool ReadVertexStream(Stream& fileStream, const ContainerSection& section, const std::size_t stride,
+                      std::pmr::vector<T>& dst)
+{
+    if ( stride == 0 || section.size % stride != 0 )
+        return false;
+    dst.resize( static_cast<std::size_t>( section.size / sizeof( T ) ) );
+    if ( section.size != 0 )
+        fileStream.Read( dst.data(), static_cast<int>( section.size ) );
+    CopyCounter::AddVertexBytes( static_cast<std::size_t>( section.size ) );
+    return true;
+}
+
+//_Xg[ɕēǂݍ񂾒_AcodecX̕тvertexDatasɕϊ
+//ʒuȆ̗vfE(skinsnꍇ)BoneIndex & BoneWeightSđ_Ńt@C̕тɑgݒĕϊAXg[͋ɂ
+//codecꍇƁA܂ĂȂꍇ͉Ȃ
+template <class Vector>
+bool DecodeVertexStreams(const VertexCodec* codec, std::pmr::vector<Float3>& positions, std::pmr::vector<char>& attributes,
+                         std::pmr::vector<VertexSkin>* skins, Vector& vertexDatas)
+{
+    using X = typename Vector::value_type;
+    if ( codec == nullptr )
+        return true;
+    const auto skinSize = skins != nullptr ? sizeof( VertexSkin ) : 0;
+    const auto packedSize = codec->GetPackedVertexSize();
+    if ( codec->GetEncoding() != 0 || codec->GetVertexSize() != sizeof( X ) || packedSize < sizeof( Float3 ) + skinSize )
+        return false;
+    const auto attributeSize = packedSize - sizeof( Float3 ) - skinSize;
+    const auto count = positions.size();
+    if ( count == 0 || attributes.size() != attributeSize * count || ( skins != nullptr && skins->size() != count ) )
+        return true;
+    std::vector<char> records( packedSize * count );
+    for ( std::size_t i = 0; i < count; i++ )
+    {
+        auto* record = records.data() + packedSize * i;
+        memcpy( record, &positions[i], sizeof( Float3 ) );
+        memcpy( record + sizeof( Float3 ), attributes.data() + attributeSize * i, attributeSize );
+        if ( skins != nullptr )
+            memcpy( record + sizeof( Float3 ) + attributeSize, &( *skins )[i], sizeof( VertexSkin ) );
+    }
+    vertexDatas.resize( count );
+    codec->Decode( records.data(), count, Bounds{}, vertexDatas.data() );
+    CopyCounter::AddVertexBytes( sizeof( X ) * count );
+    positions.clear();
+    positions.shrink_to_fit();
+    attributes.clear();
+    attributes.shrink_to_fit();
+    if ( skins != nullptr )
+    {
+        skins->clear();
+        skins->shrink_to_fit();
+    }
+    return true;
+}
+
+//_Xg[̃ZNVr[w
+template <class T>
+bool MapVertexStream(const ContainerView& container, const ContainerSectionType type, const uint32_t index,
+                     const std::size_t stride, ArrayView<T>& dst)
+{
+    const auto* section = container.Find( type, index );
+    if ( section == nullptr || stride == 0 || section->size % stride != 0 )
+        return false;
+    dst.ptr = reinterpret_cast<const T*>( container.GetData( *section ) );
+    dst.count = static_cast<std::size_t>( section->size / sizeof( T ) );
+    return true;
+}
+
+//RpNg`̃Nbv
+//gbN͈ʒu(float x3)E](Quaternion48)EXP[(float x3)3ŁASĂ̗vf̃gbN͒l1
+//ωgbN̓Nbvʂ̃Tv[gł̃t[ԍ(uint16_t)ƁÃt[̒l
+struct ClipInfo
+{
+    float sampleRate; //1b̃t[
+    float duration; //Ō̃L[̎
+    uint32_t boneCount;
+    uint32_t dataSize; //SẴgbÑf[^̃oCg
+};
+
+static constexpr int ClipTrackCount = 3;
+static constexpr std::size_t ClipTrackValueSizes[ClipTrackCount] = {
+    sizeof( float ) * 3, sizeof( Quaternion48 ), sizeof( float ) * 3
+};
+static constexpr uint32_t ClipMaxKeyCount = 0xffff;
+//gbNƂ̋`̃J[u͈̔(ʒuxyzE]xyzwEXP[xyz)
+static constexpr int ClipTrackFirstCurves[ClipTrackCount + 1] = { 0, 3, 7, 10 };
+
+//gbÑf[^̃oCg
+//[uint16_t t[ԍ * keyCount(萔Ȃ疳)][l * keyCount]̏ŁAꂼ4byteEɑ
+inline std::size_t GetClipTrackSize(const uint32_t keyCount, const int track)
+{
+    const auto frameSize = keyCount > 1 ? ( sizeof( uint16_t ) * keyCount + 3 ) / 4 * 4 : 0;
+    return frameSize + ( ClipTrackValueSizes[track] * keyCount + 3 ) / 4 * 4;
+}
+
+//ϊÕAj[V1(`̕)
+struct ClipSource
+{
+    std::string name;
+    std::vector<float> times[10];
+    std::vector<float> keys[10];
+};
+
+inline bool ReadClipSource(MemoryStream& stream, ClipSource& source)
+{
+    uint16_t nameCount;
+    stream.Read( &nameCount, sizeof( uint16_t ) );
+    if ( stream.Tell() > stream.GetSize() || nameCount > stream.GetSize() - stream.Tell() )
+        return false;
+    source.name.resize( nameCount );
+    stream.Read( &source.name[0], nameCount );
+    for ( auto i = 0; i < 10; i++ )
+    {
+        uint32_t keyCount;
+        stream.Read( &keyCount, sizeof( uint32_t ) );
+        if ( stream.Tell() > stream.GetSize() ||
+            static_cast<uint64_t>( keyCount ) * sizeof( float ) * 2 > stream.GetSize() - stream.Tell() )
+            return false;
+        source.times[i].resize( keyCount );
+        source.keys[i].resize( keyCount );
+        stream.Read( source.times[i].data(), static_cast<int>( sizeof( float ) * keyCount ) );
+        stream.Read( source.keys[i].data(), static_cast<int>( sizeof( float ) * keyCount ) );
+    }
+    return stream.Tell() <= stream.GetSize();
+}
+
+//SẴL[̎Ԃt[ɏŏ̃Tv[gI(ǂɂȂ΍ő̂)
+inline float ChooseClipSampleRate(const std::vector<ClipSource>& sources)
+{
+    static constexpr float SampleRates[] = { 24, 25, 30, 50, 60, 120 };
+    for ( const auto rate : SampleRates )
+    {
+        auto aligned = true;
+        for ( const auto& source : sources )
+        {
+            for ( const auto& times : source.times )
+            {
+                for ( const auto time : times )
+                    aligned &= std::fabs( time * rate - std::round( time * rate ) ) < 1e-3f;
+            }
+        }
+        if ( aligned )
+            return rate;
+    }
+    return SampleRates[std::size( SampleRates ) - 1];
+}
+
+//`Ɠ敪`̕(L[defaultValue)
+inline float EvaluateLinearCurve(const std::vector<float>& times, const std::vector<float>& keys, const float time,
+                                 const float defaultValue)
+{
+    if ( times.empty() )
+        return defaultValue;
+    const auto itr = std::upper_bound( times.begin(), times.end(), time );
+    if ( itr == times.begin() )
+        return keys.front();
+    if ( itr == times.end() )
+        return keys.back();
+    const auto index = static_cast<std::size_t>( itr - times.begin() ) - 1;
+    return keys[index] + ( keys[index + 1] - keys[index] ) * ( time - times[index] ) / ( times[index + 1] - times[index] );
+}
+
+//HermiteAnimationZNVŃL[炷̋e덷(`̕ԂƂ̍)
+static constexpr float HermiteTolerance = 1e-4f;
+
+//`̃J[utoleranceȓŋߎHermiteȐ
+//L[̌X͑ÕL[Ƃ̍ŋ߁Ae덷𒴂Ԃ͌덷ő̃L[ŕĂ
+//̐̏ł͐Ƃ̍3ɂȂ̂ŁA̒[ƍ̋ɒlŒׂΐ̊Ԃ̍s߂܂߂Č덷
+//ׂ荇L[̋Ԃ͌X̌Xɂ̂ŁA`ƓlɂȂ
+inline void FitHermiteCurve(const std::vector<float>& times, const std::vector<float>& keys, const float tolerance,
+                            std::vector<float>& dstTimes, std::vector<float>& dstKeys, std::vector<float>& inSlopes,
+                            std::vector<float>& outSlopes)
+{
+    dstTimes.clear();
+    dstKeys.clear();
+    inSlopes.clear();
+    outSlopes.clear();
+    const auto count = times.size();
+    if ( count == 0 )
+        return;
+    auto secant = [&](const std::size_t a, const std::size_t b)
+    {
+        return times[b] > times[a] ? ( keys[b] - keys[a] ) / ( times[b] - times[a] ) : 0.0f;
+    };
+    //ωȂJ[u̓L[1
+    if ( std::all_of( keys.begin(), keys.end(), [&keys](const float key) { return key == keys.front(); } ) )
+    {
+        dstTimes.push_back( times.front() );
+        dstKeys.push_back( keys.front() );
+        inSlopes.push_back( 0 );
+        outSlopes.push_back( 0 );
+        return;
+    }
+
+    std::vector<float> in( count ), out( count );
+    for ( std::size_t i = 0; i < count; i++ )
+        in[i] = out[i] = secant( i > 0 ? i - 1 : i, i + 1 < count ? i + 1 : i );
+    std::vector<bool> kept( count );
+    kept.front() = kept.back() = true;
+    std::vector<std::pair<std::size_t, std::size_t>> segments{ { 0, count - 1 } };
+    while ( !segments.empty() )
+    {
+        const auto [a, b] = segments.back();
+        segments.pop_back();
+        if ( b == a + 1 )
+        {
+            out[a] = in[b] = secant( a, b );
+            continue;
+        }
+        //ԓ̌̃L[ƁA̐Ƃ̍̋ɒlŌ덷𒲂ׂ
+        //Ԃ̈ʒuuł̒l( ( c3 * u + c2 ) * u + c1 ) * u + c0
+        const auto dt = times[b] - times[a];
+        const auto m0 = out[a] * dt;
+        const auto m1 = in[b] * dt;
+        const auto c1 = m0;
+        const auto c2 = 3 * ( keys[b] - keys[a] ) - 2 * m0 - m1;
+        const auto c3 = 2 * ( keys[a] - keys[b] ) + m0 + m1;
+        auto fits = true;
+        auto worst = 0.0f;
+        auto split = ( a + b ) / 2;
+        for ( auto i = a; i < b; i++ )
+        {
+            const auto u0 = ( times[i] - times[a] ) / dt;
+            const auto u1 = ( times[i + 1] - times[a] ) / dt;
+            const auto slope = ( keys[i + 1] - keys[i] ) / ( u1 - u0 );
+            //̔ 3 * c3 * u^2 + 2 * c2 * u + ( c1 - slope ) = 0 ƂȂʒu
+            float candidates[3] = { u1, -1, -1 };
+            const auto qa = 3 * c3;
+            const auto qb = 2 * c2;
+            const auto qc = c1 - slope;
+            if ( std::fabs( qa ) < 1e-12f )
+            {
+                if ( qb != 0 )
+                    candidates[1] = -qc / qb;
+            }
+            else if ( const auto discriminant = qb * qb - 4 * qa * qc; discriminant >= 0 )
+            {
+                const auto root = std::sqrt( discriminant );
+                candidates[1] = ( -qb - root ) / ( 2 * qa );
+                candidates[2] = ( -qb + root ) / ( 2 * qa );
+            }
+            for ( auto j = 0; j < 3; j++ )
+            {
+                const auto u = candidates[j];
+                //Ԃ̏ĨL[͂̂܂܎ĉŒׂȂ
+                if ( j == 0 ? i + 1 == b : !( u > u0 && u < u1 ) )
+                    continue;
+                const auto source = j == 0 ? keys[i + 1] : keys[i] + slope * ( u - u0 );
+                const auto value = GetHermiteBasis( u, dt ).Evaluate( keys[a], out[a], keys[b], in[b] );
+                const auto error = std::fabs( value - source );
+                if ( error <= tolerance )
+                    continue;
+                fits = false;
+                if ( j == 0 && error > worst )
+                {
+                    worst = error;
+                    split = i + 1;
+                }
+            }
+        }
+        if ( fits )
+            continue;
+        kept[split] = true;
+        segments.emplace_back( a, split );
+        segments.emplace_back( split, b );
+    }
+    for ( std::size_t i = 0; i < count; i++ )
+    {
+        if ( !kept[i] )
+            continue;
+        dstTimes.push_back( times[i] );
+        dstKeys.push_back( keys[i] );
+        inSlopes.push_back( in[i] );
+        outSlopes.push_back( out[i] );
+    }
+}
+
+//`̓ǂݍ(RotationCurve::Build)Ɠ]̃L[
+//4vf̃L[̎Ԃ킹ĐKAÕL[Ɠɑ(L[̖vf͒PʃNH[^jI̒l)
+//̃L[͒1炸Ă邱Ƃ̂ŁAvfƂɋߎĂ琳KƋ`Ƃ̍e덷𒴂
+inline void BuildRotationSource(const ClipSource& source, std::vector<float>& times, std::vector<float> (&keys)[4])
+{
+    static constexpr float Identity[4] = { 0, 0, 0, 1 };
+    times.clear();
+    for ( auto c = 3; c < 7; c++ )
+        times.insert( times.end(), source.times[c].begin(), source.times[c].end() );
+    std::sort( times.begin(), times.end() );
+    times.erase( std::unique( times.begin(), times.end() ), times.end() );
+    for ( auto& values : keys )
+        values.resize( times.size() );
+    for ( std::size_t k = 0; k < times.size(); k++ )
+    {
+        float value[4];
+        for ( auto i = 0; i < 4; i++ )
+            value[i] = EvaluateLinearCurve( source.times[3 + i], source.keys[3 + i], times[k], Identity[i] );
+        NormalizeQuaternion( value );
+        if ( k > 0 && keys[0][k - 1] * value[0] + keys[1][k - 1] * value[1] + keys[2][k - 1] * value[2] +
+            keys[3][k - 1] * value[3] < 0 )
+        {
+            for ( auto& v : value )
+                v = -v;
+        }
+        for ( auto i = 0; i < 4; i++ )
+            keys[i][k] = value[i];
+    }
+}
+
+//HermiteAnimationZNV(O, (uint32_t keyCount, times, keys, inSlopes, outSlopes) * 10)
+//]̗vfBuildRotationSourceőL[ߎ
+inline void EncodeHermiteAnimation(const ClipSource& source, const float tolerance, std::vector<char>& dst)
+{
+    auto write = [&dst](const void* data, const std::size_t size)
+    {
+        dst.insert( dst.end(), static_cast<const char*>( data ), static_cast<const char*>( data ) + size );
+    };
+    const auto nameCount = static_cast<uint16_t>( source.name.size() );
+    write( &nameCount, sizeof( uint16_t ) );
+    write( source.name.data(), nameCount );
+
+    std::vector<float> rotationTimes, rotationKeys[4];
+    BuildRotationSource( source, rotationTimes, rotationKeys );
+    std::vector<float> times, keys, inSlopes, outSlopes;
+    for ( auto c = 0; c < 10; c++ )
+    {
+        const auto rotation = c >= 3 && c < 7;
+        FitHermiteCurve( rotation ? rotationTimes : source.times[c], rotation ? rotationKeys[c - 3] : source.keys[c], tolerance,
+                         times, keys, inSlopes, outSlopes );
+        const auto keyCount = static_cast<uint32_t>( times.size() );
+        write( &keyCount, sizeof( uint32_t ) );
+        for ( const auto* values : { &times, &keys, &inSlopes, &outSlopes } )
+            write( values->data(), sizeof( float ) * keyCount );
+    }
+}
+
+//ClipBoneZNV(O, (uint32_t keyCount, gbÑf[^) * ClipTrackCount)
+//ωgbN͗vf̃L[̃t[킹̂L[ɂAet[̒l͋`̕Ԃŋ߂
+inline bool EncodeClipBone(const ClipSource& source, const float sampleRate, std::vector<char>& dst)
+{
+    static constexpr float DefaultValues[10] = { 0, 0, 0, 0, 0, 0, 1, 1, 1, 1 };
+    auto write = [&dst](const void* data, const std::size_t size)
+    {
+        dst.insert( dst.end(), static_cast<const char*>( data ), static_cast<const char*>( data ) + size );
+    };
+    const auto nameCount = static_cast<uint16_t>( source.name.size() );
+    write( &nameCount, sizeof( uint16_t ) );
+    write( source.name.data(), nameCount );
+
+    for ( auto track = 0; track < ClipTrackCount; track++ )
+    {
+        std::vector<uint16_t> frames;
+        for ( auto c = ClipTrackFirstCurves[track]; c < ClipTrackFirstCurves[track + 1]; c++ )
+        {
+            const auto& keys = source.keys[c];
+            if ( std::all_of( keys.begin(), keys.end(), [&keys](const float key) { return key == keys.front(); } ) )
+                continue;
+            for ( const auto time : source.times[c] )
+            {
+                const auto frame = std::lround( time * sampleRate );
+                if ( frame < 0 || frame > static_cast<long>( ClipMaxKeyCount ) )
+                    return false;
+                frames.push_back( static_cast<uint16_t>( frame ) );
+            }
+        }
+        std::sort( frames.begin(), frames.end() );
+        frames.erase( std::unique( frames.begin(), frames.end() ), frames.end() );
+        if ( frames.empty() )
+            frames.push_back( 0 );
+
+        const auto keyCount = static_cast<uint32_t>( frames.size() );
+        write( &keyCount, sizeof( uint32_t ) );
+        const auto begin = dst.size();
+        if ( keyCount > 1 )
+            write( frames.data(), sizeof( uint16_t ) * keyCount );
+        dst.resize( begin + ( dst.size() - begin + 3 ) / 4 * 4 );
+        for ( const auto frame : frames )
+        {
+            float value[4];
+            for ( auto c = ClipTrackFirstCurves[track]; c < ClipTrackFirstCurves[track + 1]; c++ )
+            {
+                value[c - ClipTrackFirstCurves[track]] = EvaluateLinearCurve( source.times[c], source.keys[c], frame / sampleRate,
+                                                                     DefaultValues[c] );
+            }
+            if ( track == 1 )
+            {
+                const auto rotation = Quaternion48::Encode( value );
+                write( &rotation, sizeof( Quaternion48 ) );
+            }
+            else
+                write( value, sizeof( float ) * 3 );
+        }
+        dst.resize( begin + GetClipTrackSize( keyCount, track ) );
+    }
+    return true;
+}
+
+//.umb/.usb𑖍ăbVItZbge[u𖖔ɒǉ
+inline bool AppendMeshOffsetTable(const std::string& filename, const bool skinned)
+{
+    std::vector<uint64_t> offsets;
+    {
+        MappedFileStream file;
+        if ( !file.Load( filename.c_str() ) )
+            return false;
+        //Rei`̓ZNVe[uŊebVֈړł̂ŕsv
+        if ( IsContainerData( file.GetData(), file.GetSize() ) )
+            return true;
+        MemoryStream stream( file.GetData(), file.GetSize() );
+        if ( skinned )
+            SkipHierarchyBinary( stream );
+
+        short vertexFormat;
+        stream.Read( &vertexFormat, sizeof( short ) );
+        uint16_t modelCount;
+        stream.Read( &modelCount, sizeof( uint16_t ) );
+        if ( ReadMeshOffsetTable( file.GetData(), file.GetSize(), modelCount, offsets ) )
+            return true;
+
+        const std::size_t vertexSize = ( skinned ? 32 : 0 ) + GetVertexFormatSize( vertexFormat ); //BoneIndex & BoneWeight
+
+        for ( auto i = 0; i < modelCount; i++ )
+        {
+            offsets.push_back( stream.Tell() );
+            uint32_t vertexCount;
+            stream.Read( &vertexCount, sizeof( uint32_t ) );
+            stream.Skip( vertexSize * vertexCount );
+            uint32_t indexCount;
+            stream.Read( &indexCount, sizeof( uint32_t ) );
+            stream.Skip( sizeof( uint32_t ) * indexCount );
+            if ( skinned )
+            {
+                uint16_t basePoseCount;
+                stream.Read( &basePoseCount, sizeof( uint16_t ) );
+                for ( auto j = 0; j < basePoseCount; j++ )
+                {
+                    SkipString( stream );
+                    stream.Skip( sizeof( float ) * 16 );
+                }
+            }
+            SkipMaterialBinary( stream );
+            if ( stream.Tell() > stream.GetSize() )
+                return false;
+        }
+    }
+
+    FILE* fp;
+    if ( fopen_s( &fp, filename.c_str(), "ab" ) != 0 )
+        return false;
+    const auto count = static_cast<uint32_t>( offsets.size() );
+    fwrite( offsets.data(), sizeof( uint64_t ), offsets.size(), fp );
+    fwrite( &count, sizeof( uint32_t ), 1, fp );
+    fwrite( &MeshOffsetTableMagic, sizeof( uint32_t ), 1, fp );
+    fclose( fp );
+    return true;
+}
+
+//UpgradeBinaryFileōstk
+enum class CompressFlg
+{
+    MESH = 0x0001, //_ƃCfbNXVertexStreamCodec/IndexStreamCodecňk
+    BLOCKS = 0x0002, //bVȊÕZNVContainerBlockSizeƂLzCodecňk
+    CLIP = 0x0004, //Aj[VRpNg`(ClipInfo/ClipBone)ŏ(]ƃL[̎Ԃ͗ʎq)
+    HERMITE = 0x0008, //Aj[VHermiteȐ(HermiteAnimation)ɂăL[炷(CLIPƂ͕płȂ)
+};
+
+//`.umb/.usb/.usabRei`ɕϊ
+//ẽoCg͂̂܂܈ڂAZNV̐擪16byteEɑ
+//vertexEncodingEncodeFlgw肷ƒ_kAbVƂBounds
+//compressCompressFlgw肷ƃZNVtk(ȂȂZNV͂̂܂)
+//splitStreamsw肷ƒ_ʒuȆ̗vfEBoneIndex & BoneWeight̃Xg[ɕď(_̈kƂ͕płȂ)
+inline bool UpgradeBinaryFile(const std::string& srcFilename, const std::string& dstFilename, const ContainerKind kind,
+                              const int vertexEncoding = 0, const int compress = 0, const bool splitStreams = false)
+{
+    struct Range
+    {
+        ContainerSectionType type;
+        uint32_t index;
+        const char* data;
+        std::size_t size;
+        uint32_t flags = 0; //BlockCompressedSectionFlag
+    };
+
+    MappedFileStream file;
+    if ( !file.Load( srcFilename.c_str() ) || IsContainerData( file.GetData(), file.GetSize() ) )
+        return false;
+    MemoryStream stream( file.GetData(), file.GetSize() );
+    std::vector<Range> ranges;
+    std::vector<std::vector<char>> encodedDatas;
+    std::size_t storedVertexSize = 0; //VerticesZNV1_̃oCg
+    auto begin = stream.Tell();
+    auto add = [&](const ContainerSectionType type, const uint32_t index)
+    {
+        ranges.push_back( Range{ type, index, file.GetData() + begin, stream.Tell() - begin } );
+        begin = stream.Tell();
+    };
+    auto addData = [&](const ContainerSectionType type, const uint32_t index, std::vector<char>&& data)
+    {
+        encodedDatas.push_back( std::move( data ) );
+        ranges.push_back( Range{ type, index, encodedDatas.back().data(), encodedDatas.back().size() } );
+    };
+
+    if ( ( compress & static_cast<int>( CompressFlg::CLIP ) ) && ( compress & static_cast<int>( CompressFlg::HERMITE ) ) )
+        return false;
+    if ( kind == ContainerKind::Animation && ( compress & static_cast<int>( CompressFlg::CLIP ) ) )
+    {
+        uint32_t animationCount;
+        stream.Read( &animationCount, sizeof( uint32_t ) );
+        if ( animationCount > stream.GetSize() )
+            return false;
+        std::vector<ClipSource> sources( animationCount );
+        for ( auto& source : sources )
+        {
+            if ( !ReadClipSource( stream, source ) )
+                return false;
+        }
+        ClipInfo info{ ChooseClipSampleRate( sources ), 0, animationCount, 0 };
+        std::vector<std::vector<char>> bones( animationCount );
+        for ( uint32_t i = 0; i < animationCount; i++ )
+        {
+            if ( !EncodeClipBone( sources[i], info.sampleRate, bones[i] ) )
+                return false;
+            for ( const auto& times : sources[i].times )
+            {
+                if ( !times.empty() )
+                    info.duration = std::max<float>( info.duration, *std::max_element( times.begin(), times.end() ) );
+            }
+        }
+        //gbÑf[^ȊO(OƃL[)vǂݍݎ̊mۂɎg
+        for ( uint32_t i = 0; i < animationCount; i++ )
+            info.dataSize += static_cast<uint32_t>( bones[i].size() - sizeof( uint16_t ) - sources[i].name.size() -
+                sizeof( uint32_t ) * ClipTrackCount );
+        addData( ContainerSectionType::ClipInfo, 0,
+                 std::vector<char>( reinterpret_cast<const char*>( &info ),
+                                    reinterpret_cast<const char*>( &info ) + sizeof( ClipInfo ) ) );
+        for ( uint32_t i = 0; i < animationCount; i++ )
+            addData( ContainerSectionType::ClipBone, i, std::move( bones[i] ) );
+    }
+    else if ( kind == ContainerKind::Animation && ( compress & static_cast<int>( CompressFlg::HERMITE ) ) )
+    {
+        uint32_t animationCount;
+        stream.Read( &animationCount, sizeof( uint32_t ) );
+        if ( animationCount > stream.GetSize() )
+            return false;
+        add( ContainerSectionType::AnimationInfo, 0 );
+        for ( uint32_t i = 0; i < animationCount; i++ )
+        {
+            ClipSource source;
+            if ( !ReadClipSource( stream, source ) )
+                return false;
+            std::vector<char> data;
+            EncodeHermiteAnimation( source, HermiteTolerance, data );
+            addData( ContainerSectionType::HermiteAnimation, i, std::move( data ) );
+        }
+    }
+    else if ( kind == ContainerKind::Animation )
+    {
+        uint32_t animationCount;
+        stream.Read( &animationCount, sizeof( uint32_t ) );
+        add( ContainerSectionType::AnimationInfo, 0 );
+        for ( uint32_t i = 0; i < animationCount; i++ )
+        {
+            SkipString( stream );
+            for ( auto j = 0; j < 10; j++ )
+            {
+                uint32_t keyCount;
+                stream.Read( &keyCount, sizeof( uint32_t ) );
+                stream.Skip( sizeof( float ) * 2 * keyCount );
+            }
+            if ( stream.Tell() > stream.GetSize() )
+                return false;
+            add( ContainerSectionType::Animation, i );
+        }
+    }
+    else
+    {
+        const auto skinned = kind == ContainerKind::SkinnedModel;
+        if ( skinned )
+        {
+            SkipHierarchyBinary( stream );
+            add( ContainerSectionType::Hierarchy, 0 );
+        }
+        short vertexFormat;
+        stream.Read( &vertexFormat, sizeof( short ) );
+        uint16_t modelCount;
+        stream.Read( &modelCount, sizeof( uint16_t ) );
+        add( ContainerSectionType::ModelInfo, 0 );
+
+        const VertexCodec codec( vertexFormat, vertexEncoding, skinned );
+        storedVertexSize = codec.GetPackedVertexSize();
+        if ( splitStreams && ( codec.GetEncoding() != 0 || !( vertexFormat & static_cast<int>( Flg::POSITION ) ) ) )
+            return false;
+        if ( codec.GetEncoding() != 0 )
+        {
+            const auto encoding = static_cast<uint32_t>( codec.GetEncoding() );
+            addData( ContainerSectionType::VertexEncoding, 0,
+                     std::vector<char>( reinterpret_cast<const char*>( &encoding ),
+                                        reinterpret_cast<const char*>( &encoding ) + sizeof( uint32_t ) ) );
+        }
+
+        const std::size_t vertexSize = ( skinned ? 32 : 0 ) + GetVertexFormatSize( vertexFormat ); //BoneIndex & BoneWeight
+        //E͒_̐擪ʒuƂċ߂̂ŁAʒu̖tH[}bgł͏܂Ȃ
+        const auto hasPosition = ( vertexFormat & static_cast<int>( Flg::POSITION ) ) != 0;
+        for ( auto i = 0; i < modelCount; i++ )
+        {
+            //vf̓ZNṼTCY狁߂̂ŏ܂Ȃ
+            uint32_t vertexCount;
+            stream.Read( &vertexCount, sizeof( uint32_t ) );
+            begin = stream.Tell();
+            stream.Skip( vertexSize * vertexCount );
+            if ( stream.Tell() > stream.GetSize() )
+                return false;
+            const auto* vertices = file.GetData() + begin;
+            if ( codec.GetEncoding() != 0 )
+            {
+                const auto bounds = codec.ComputeBounds( vertices, vertexCount );
+                addData( ContainerSectionType::Bounds, i,
+                         std::vector<char>( reinterpret_cast<const char*>( &bounds ),
+                                            reinterpret_cast<const char*>( &bounds ) + sizeof( Bounds ) ) );
+                std::vector<char> packed( codec.GetPackedVertexSize() * vertexCount );
+                if ( !codec.Encode( vertices, vertexCount, bounds, packed.data() ) )
+                    return false;
+                addData( ContainerSectionType::Vertices, i, std::move( packed ) );
+                begin = stream.Tell();
+            }
+            else if ( splitStreams )
+            {
+                //ʒu͒_̐擪ɂABoneIndex & BoneWeight͖ɂ
+                const auto attributeSize = GetVertexFormatSize( vertexFormat ) - sizeof( Float3 );
+                std::vector<char> positions( sizeof( Float3 ) * vertexCount );
+                std::vector<char> attributes( attributeSize * vertexCount );
+                std::vector<char> skins( skinned ? sizeof( VertexSkin ) * vertexCount : 0 );
+                for ( uint32_t j = 0; j < vertexCount; j++ )
+                {
+                    const auto* vertex = vertices + vertexSize * j;
+                    memcpy( positions.data() + sizeof( Float3 ) * j, vertex, sizeof( Float3 ) );
+                    memcpy( attributes.data() + attributeSize * j, vertex + sizeof( Float3 ), attributeSize );
+                    if ( skinned )
+                        memcpy( skins.data() + sizeof( VertexSkin ) * j, vertex + sizeof( Float3 ) + attributeSize,
+                                sizeof( VertexSkin ) );
+                }
+                addData( ContainerSectionType::PositionStream, i, std::move( positions ) );
+                if ( attributeSize != 0 )
+                    addData( ContainerSectionType::AttributeStream, i, std::move( attributes ) );
+                if ( skinned )
+                    addData( ContainerSectionType::SkinStream, i, std::move( skins ) );
+                begin = stream.Tell();
+            }
+            else
+                add( ContainerSectionType::Vertices, i );
+            if ( hasPosition )
+            {
+                const auto meshBounds = ComputeMeshBounds( vertices, vertexCount, vertexSize );
+                addData( ContainerSectionType::MeshBounds, i,
+                         std::vector<char>( reinterpret_cast<const char*>( &meshBounds ),
+                                            reinterpret_cast<const char*>( &meshBounds ) + sizeof( MeshBounds ) ) );
+            }
+            uint32_t indexCount;
+            stream.Read( &indexCount, sizeof( uint32_t ) );
+            begin = stream.Tell();
+            stream.Skip( sizeof( uint32_t ) * indexCount );
+            if ( stream.Tell() > stream.GetSize() )
+                return false;
+            if ( GetIndexStride( vertexCount ) == sizeof( uint16_t ) )
+            {
+                IndexArray indexes;
+                indexes.Assign( file.GetData() + begin, indexCount, vertexCount );
+                const auto* bytes = static_cast<const char*>( indexes.data() );
+                addData( ContainerSectionType::ShortIndexes, i,
+                         std::vector<char>( bytes, bytes + sizeof( uint16_t ) * indexCount ) );
+                begin = stream.Tell();
+            }
+            else
+                add( ContainerSectionType::Indexes, i );
+            if ( skinned )
+            {
+                uint16_t basePoseCount;
+                stream.Read( &basePoseCount, sizeof( uint16_t ) );
+                std::vector<std::array<float, 16>> bindPoses( basePoseCount );
+                for ( auto& bindPose : bindPoses )
+                {
+                    SkipString( stream );
+                    if ( stream.Tell() + sizeof( float ) * 16 > stream.GetSize() )
+                        return false;
+                    stream.Read( bindPose.data(), sizeof( float ) * 16 );
+                }
+                add( ContainerSectionType::BindPoses, i );
+                if ( hasPosition )
+                {
+                    const auto boneBounds = ComputeBoneBounds( vertices, vertexCount, vertexSize,
+                                                               vertexSize - sizeof( VertexSkin ), bindPoses );
+                    addData( ContainerSectionType::BoneBounds, i,
+                             std::vector<char>( reinterpret_cast<const char*>( boneBounds.data() ),
+                                                reinterpret_cast<const char*>( boneBounds.data() + boneBounds.size() ) ) );
+                }
+            }
+            SkipMaterialBinary( stream );
+            if ( stream.Tell() > stream.GetSize() )
+                return false;
+            add( ContainerSectionType::Material, i );
+        }
+    }
+
+    //tkꍇ͒_ƃCfbNX̃ZNVu
+    if ( compress & static_cast<int>( CompressFlg::MESH ) )
+    {
+        std::vector<Range> compressedRanges;
+        compressedRanges.reserve( ranges.size() );
+        for ( const auto& range : ranges )
+        {
+            auto type = range.type;
+            std::vector<char> compressed;
+            if ( type == ContainerSectionType::Vertices && storedVertexSize != 0 )
+            {
+                compressed = VertexStreamCodec::Encode( range.data, range.size / storedVertexSize, storedVertexSize );
+                type = ContainerSectionType::CompressedVertices;
+            }
+            else if ( type == ContainerSectionType::Indexes || type == ContainerSectionType::ShortIndexes )
+            {
+                const auto stride = type == ContainerSectionType::Indexes ? sizeof( uint32_t ) : sizeof( uint16_t );
+                compressed = IndexStreamCodec::Encode( IndexView{ range.data, range.size / stride, stride } );
+                type = ContainerSectionType::CompressedIndexes;
+            }
+            //ΏۊOkłȂ(Op`XgłȂ)ZNV͂̂܂܎c
+            if ( compressed.empty() )
+            {
+                compressedRanges.push_back( range );
+                continue;
+            }
+            encodedDatas.push_back( std::move( compressed ) );
+            compressedRanges.push_back( Range{ type, range.index, encodedDatas.back().data(), encodedDatas.back().size() } );
+        }
+        ranges = std::move( compressedRanges );
+    }
+
+    //bVȊÕZNV̓ubNPʂňk(_ƃCfbNX̓r[̂܂܎w悤c)
+    if ( compress & static_cast<int>( CompressFlg::BLOCKS ) )
+    {
+        for ( auto& range : ranges )
+        {
+            switch ( range.type )
+            {
+            case ContainerSectionType::Vertices:
+            case ContainerSectionType::Indexes:
+            case ContainerSectionType::ShortIndexes:
+            case ContainerSectionType::CompressedVertices:
+            case ContainerSectionType::CompressedIndexes:
+            case ContainerSectionType::PositionStream:
+            case ContainerSectionType::AttributeStream:
+            case ContainerSectionType::SkinStream:
+                continue;
+            default:
+                break;
+            }
+            auto compressed = CompressBlocks( range.data, range.size );
+            if ( compressed.empty() )
+                continue;
+            encodedDatas.push_back( std::move( compressed ) );
+            range = Range{
+                range.type, range.index, encodedDatas.back().data(), encodedDatas.back().size(), BlockCompressedSectionFlag
+            };
+        }
+    }
+
+    //ZNV̔zu߂
+    std::vector<ContainerSection> sections( ranges.size() );
+    uint64_t offset = sizeof( ContainerHeader ) + sizeof( ContainerSection ) * ranges.size();
+    for ( std::size_t i = 0; i < ranges.size(); i++ )
+    {
+        offset = ( offset + ContainerAlignment - 1 ) / ContainerAlignment * ContainerAlignment;
+        sections[i] = ContainerSection{
+            static_cast<uint32_t>( ranges[i].type ) | ranges[i].flags, ranges[i].index, offset, ranges[i].size
+        };
+        offset += sections[i].size;
+    }
+    const ContainerHeader header{
+        ContainerMagic, ContainerVersion, static_cast<uint16_t>( kind ), static_cast<uint32_t>( sections.size() ), 0, offset
+    };
+
+    FILE* fp;
+    if ( fopen_s( &fp, dstFilename.c_str(), "wb" ) != 0 )
+        return false;
+    fwrite( &header, sizeof( ContainerHeader ), 1, fp );
+    fwrite( sections.data(), sizeof( ContainerSection ), sections.size(), fp );
+    uint64_t position = sizeof( ContainerHeader ) + sizeof( ContainerSection ) * sections.size();
+    const char padding[ContainerAlignment]{};
+    for ( std::size_t i = 0; i < sections.size(); i++ )
+    {
+        fwrite( padding, sizeof( char ), static_cast<std::size_t>( sections[i].offset - position ), fp );
+        fwrite( ranges[i].data, sizeof( char ), ranges[i].size, fp );
+        position = sections[i].offset + sections[i].size;
+    }
+    const auto succeeded = ferror( fp ) == 0;
+    fclose( fp );
+    return succeeded;
+}
+
+template <class X>
+struct Model
+{
+private:
+    //ǂݍ񂾃f[^͑SẴA[imۂAModel̔jɂ܂Ƃ߂ĉ
+    std::unique_ptr<Arena> m_arena = std::make_unique<Arena>();
+    VertexLayout m_vertexLayout; //Ȃt@C̒_tH[}bgXvĂKv
+
+public:
+    struct Mesh
+    {
+        Mesh() = default;
+
+        explicit Mesh(std::pmr::memory_resource* resource)
+            : vertexDatas( resource ), positions( resource ), attributes( resource ), indexes( resource )
+        {
+        }
+
+        //_f[^ÖقɃRs[Ȃ悤[û݋
+        Mesh(Mesh&&) = default;
+        Mesh& operator=(Mesh&&) = default;
+        Mesh(const Mesh&) = delete;
+        Mesh& operator=(const Mesh&) = delete;
+
+        std::size_t GetVertexCount() const
+        {
+            return positions.empty() ? vertexDatas.size() : positions.size();
+        }
+
+        //1_attributes̃oCg(Xʒu)
+        static constexpr std::size_t AttributeStride = sizeof( X ) - sizeof( Float3 );
+
+        std::pmr::vector<X> vertexDatas;
+        //_Xg[ɕt@CłvertexDatas͋ŁAɓǂݍ
+        std::pmr::vector<Float3> positions;
+        std::pmr::vector<char> attributes;
+        IndexArray indexes;
+        //ϊɌvZJOp̋E(Rei`̂݁A`ł0̂܂)
+        MeshBounds meshBounds{};
+        int materialNo{};
+    };
+
+    std::vector<Mesh> m_meshes;
+    std::vector<Material> m_materials;
+
+    Model() = default;
+
+    Model(Model&& other)
+    {
+        *this = std::move( other );
+    }
+
+    Model& operator=(Model&& other)
+    {
+        if ( this != &other )
+        {
+            m_vertexLayout = std::move( other.m_vertexLayout );
+            m_meshes = std::move( other.m_meshes );
+            m_materials = std::move( other.m_materials );
+            m_arena = std::exchange( other.m_arena, std::make_unique<Arena>() );
+        }
+        return *this;
+    }
+
+    //X̗vf̕тw肷ƁA_tH[}bgXƈقȂt@CvfƂɕϊēǂݍ
+    //Xɖvf͎̂āAt@CɖvfX̊l̂܂܂ɂ(ModelViewȂǂ̃r[ɂ͎gȂ)
+    bool SetVertexLayout(const VertexLayout& layout)
+    {
+        if ( !CheckVertexSize<X>( layout.stride ) || !layout.IsValid() )
+            return false;
+        m_vertexLayout = layout;
+        return true;
+    }
+
+    void LoadAscii(std::string& filename)
+    {
+        LoadAsciiFile( filename, nullptr );
+    }
+
+    //_ƃCfbNX̐lϊXbhv[ŕɍs(ʂLoadAsciiƓ)
+    void LoadAsciiParallel(std::string& filename, ThreadPool& threadPool = ThreadPool::GetDefault())
+    {
+        LoadAsciiFile( filename, &threadPool );
+    }
+
+private:
+    void LoadAsciiFile(std::string& filename, ThreadPool* threadPool)
+    {
+        MappedFileStream file( filename.c_str() );
+        auto lastSlash = filename.find_last_of( '/' );
+        filename.erase( lastSlash );
+        assert( file.IsOpen() );
+        AsciiTokenizer tokenizer( file.GetData(), file.GetSize() );
+        std::unique_ptr<AsciiTokenIndex> tokenIndex;
+        if ( threadPool != nullptr )
+            tokenIndex = std::make_unique<AsciiTokenIndex>( file.GetData(), file.GetSize(), *threadPool );
+
+        //_tH[}bgǂݍ
+        const auto vertexFormat = tokenizer.Read<int>();
+        const auto modelCount = tokenizer.Read<int>();
+
+        //tH[}bgG[`FbN
+        std::unique_ptr<VertexCodec> codec;
+        if ( !CreateVertexCodec( vertexFormat, 0, codec ) )
+            return;
+        const std::size_t vertexSize = GetVertexFormatSize( vertexFormat );
+
+        m_meshes.reserve( m_meshes.size() + modelCount );
+        m_materials.reserve( m_materials.size() + modelCount );
+        for ( auto i = 0; i < modelCount; i++ )
+        {
+            auto& model = m_meshes.emplace_back( m_arena.get() );
+            //_ǂݍ(SvffloatȂ̂ł܂Ƃ߂ĕϊ)
+            //Xɕϊꍇ̓t@C̕тœǂݍł܂Ƃ߂ĕϊ
+            const auto vertexCount = tokenizer.Read<int>();
+            model.vertexDatas.resize( vertexCount );
+            std::vector<char> records( codec != nullptr ? vertexSize * vertexCount : 0 );
+            auto* dst = codec != nullptr ? records.data() : reinterpret_cast<char*>( model.vertexDatas.data() );
+            ReadAsciiRecords( tokenizer, vertexCount, vertexSize / sizeof( float ), tokenIndex.get(), threadPool,
+                              [dst, vertexSize](AsciiTokenizer& recordTokenizer, const std::size_t j)
+                              {
+                                  float rawData[MaxVertexFormatSize / sizeof( float )];
+                                  recordTokenizer.Read( rawData, vertexSize / sizeof( float ) );
+                                  memcpy( dst + vertexSize * j, rawData, vertexSize );
+                              } );
+            if ( codec != nullptr )
+                codec->Decode( records.data(), vertexCount, Bounds{}, model.vertexDatas.data() );
+            CopyCounter::AddVertexBytes( sizeof( X ) * vertexCount );
+
+            //CfbNXǂݍ
+            const auto indexCount = tokenizer.Read<int>();
+            model.indexes.Resize( indexCount, model.vertexDatas.size() );
+            ReadAsciiRecords( tokenizer, indexCount, 1, tokenIndex.get(), threadPool,
+                              [&model](AsciiTokenizer& recordTokenizer, const std::size_t j)
+                              {
+                                  uint32_t index;
+                                  recordTokenizer.Read( index );
+                                  model.indexes.Set( j, index );
+                              } );
+
+            //}eA̓ǂݍ
+            model.materialNo = RegisterMaterial( m_materials, LoadMaterialAscii( tokenizer, filename, m_arena.get() ) );
+        }
+    }
+
+public:
+
+    void LoadBinary(std::string& filename)
+    {
+        FileStream fileStream( filename.c_str() );
+        auto lastSlash = filename.find_last_of( '/' );
+        filename.erase( lastSlash );
+        LoadBinaryStream( fileStream, filename );
+    }
+
+    //I/Oobt@bufferTCYɗ}ēǂݍ
+    //t@CJȂrŐ؂ĂꍇfalseԂ(ǂݍ񂾓e͎gȂ)
+    bool LoadBinary(std::string& filename, const std::size_t bufferSize)
+    {
+        StreamingFileStream fileStream( filename.c_str(), bufferSize );
+        if ( !fileStream.IsOpen() )
+            return false;
+        auto lastSlash = filename.find_last_of( '/' );
+        filename.erase( lastSlash );
+        LoadBinaryStream( fileStream, filename );
+        return !fileStream.IsFailed();
+    }
+
+    //Read(void*, int)Cӂ̃Xg[ǂݍ
+    //`ƃRei`̂ǂǂݍ߂
+    template <class Stream>
+    void LoadBinaryStream(Stream& stream, const std::string& directory)
+    {
+        ContainerStream<Stream> fileStream( stream );
+        if ( fileStream.IsContainer() )
+        {
+            LoadContainerStream( fileStream, directory );
+            return;
+        }
+
+        short vertexFormat;
+        fileStream.Read( &vertexFormat, sizeof( short ) );
+
+        uint16_t modelCount;
+        fileStream.Read( &modelCount, sizeof( uint16_t ) );
+
+        //tH[}bgG[`FbN
+        std::unique_ptr<VertexCodec> codec;
+        if ( !CreateVertexCodec( vertexFormat, 0, codec ) )
+            return;
+
+        //wb_[̃bVŊmۂĂAbV͔zɒړǂݍ
+        m_meshes.reserve( m_meshes.size() + modelCount );
+        m_materials.reserve( m_materials.size() + modelCount );
+        for ( auto i = 0; i < modelCount; i++ )
+        {
+            auto& model = m_meshes.emplace_back( m_arena.get() );
+            LoadMeshBinary( fileStream, model, codec.get() );
+
+            //}eA̓ǂݍ
+            model.materialNo = RegisterMaterial( m_materials, LoadMaterialBinary( fileStream, directory, m_arena.get() ) );
+        }
+    }
+
+    //Rei`bVItZbge[u΃bVƂɃXbhv[ŕɓǂݍ
+    //e[ut@C͒ʏ̓ǂݍ݂s
+    void LoadBinaryParallel(std::string& filename, ThreadPool& threadPool = ThreadPool::GetDefault())
+    {
+        MappedFileStream file;
+        if ( !file.Load( filename.c_str() ) )
+            return;
+        auto lastSlash = filename.find_last_of( '/' );
+        filename.erase( lastSlash );
+        if ( IsContainerData( file.GetData(), file.GetSize() ) )
+        {
+            LoadContainerParallel( file, filename, threadPool );
+            return;
+        }
+
+        MemoryStream fileStream( file.GetData(), file.GetSize() );
+        short vertexFormat;
+        fileStream.Read( &vertexFormat, sizeof( short ) );
+
+        uint16_t modelCount;
+        fileStream.Read( &modelCount, sizeof( uint16_t ) );
+
+        std::vector<uint64_t> offsets;
+        if ( !ReadMeshOffsetTable( file.GetData(), file.GetSize(), modelCount, offsets ) )
+        {
+            MemoryStream serialStream( file.GetData(), file.GetSize() );
+            LoadBinaryStream( serialStream, filename );
+            return;
+        }
+
+        //tH[}bgG[`FbN
+        std::unique_ptr<VertexCodec> codec;
+        if ( !CreateVertexCodec( vertexFormat, 0, codec ) )
+            return;
+
+        //bV͔zɒړǂݍ݁A}eApɈꎞz֓ǂ
+        const auto firstMesh = m_meshes.size();
+        std::vector<Material> materials;
+        m_meshes.reserve( firstMesh + modelCount );
+        m_materials.reserve( m_materials.size() + modelCount );
+        materials.reserve( modelCount );
+        for ( auto i = 0; i < modelCount; i++ )
+        {
+            m_meshes.emplace_back( m_arena.get() );
+            materials.emplace_back( m_arena.get() );
+        }
+        threadPool.ParallelFor( modelCount, [&](const std::size_t i)
+        {
+            MemoryStream meshStream( file.GetData() + offsets[i], file.GetSize() - offsets[i] );
+            LoadMeshBinary( meshStream, m_meshes[firstMesh + i], codec.get() );
+            materials[i] = LoadMaterialBinary( meshStream, filename, m_arena.get() );
+        } );
+
+        //}eA̓̓t@CɍsAǂݍ݂Ɠԍɂ
+        for ( auto i = 0; i < modelCount; i++ )
+        {
+            m_meshes[firstMesh + i].materialNo = RegisterMaterial( m_materials, std::move( materials[i] ) );
+        }
+    }
+
+private:
+    //Rei`ZNVe[ȕɓǂݍ
+    template <class Stream>
+    void LoadContainerStream(ContainerStream<Stream>& fileStream, const std::string& directory)
+    {
+        std::vector<ContainerSection> sections;
+        if ( !ReadContainerHeader( fileStream, ContainerKind::Model, sections ) )
+            return;
+
+        const auto firstMesh = m_meshes.size();
+        auto checked = false;
+        short vertexFormat = 0;
+        std::unique_ptr<VertexCodec> codec;
+        std::vector<Bounds> meshBounds;
+        for ( const auto& entry : sections )
+        {
+            ContainerSection section;
+            if ( !fileStream.BeginSection( entry, section ) )
+                return;
+            const auto meshNo = firstMesh + section.index;
+            switch ( static_cast<ContainerSectionType>( section.type ) )
+            {
+            case ContainerSectionType::ModelInfo:
+                {
+                    fileStream.Read( &vertexFormat, sizeof( short ) );
+                    uint16_t modelCount;
+                    fileStream.Read( &modelCount, sizeof( uint16_t ) );
+
+                    //tH[}bgG[`FbN
+                    if ( !CreateVertexCodec( vertexFormat, 0, codec ) )
+                        return;
+                    m_meshes.reserve( firstMesh + modelCount );
+                    m_materials.reserve( m_materials.size() + modelCount );
+                    meshBounds.resize( modelCount );
+                    checked = true;
+                    break;
+                }
+            case ContainerSectionType::VertexEncoding:
+                {
+                    if ( !checked )
+                        return;
+                    uint32_t encoding;
+                    fileStream.Read( &encoding, sizeof( uint32_t ) );
+                    if ( !CreateVertexCodec( vertexFormat, static_cast<int>( encoding ), codec ) )
+                        return;
+                    break;
+                }
+            case ContainerSectionType::Bounds:
+                if ( section.index >= meshBounds.size() )
+                    return;
+                fileStream.Read( &meshBounds[section.index], sizeof( Bounds ) );
+                break;
+            case ContainerSectionType::Vertices:
+            case ContainerSectionType::Indexes:
+            case ContainerSectionType::ShortIndexes:
+            case ContainerSectionType::CompressedVertices:
+            case ContainerSectionType::CompressedIndexes:
+            case ContainerSectionType::PositionStream:
+            case ContainerSectionType::AttributeStream:
+            case ContainerSectionType::MeshBounds:
+                //bV͒_̃ZNVŒǉ
+                if ( !checked )
+                    return;
+                if ( meshNo == m_meshes.size() )
+                    m_meshes.emplace_back( m_arena.get() );
+                if ( meshNo >= m_meshes.size() ||
+                    !LoadMeshSection( fileStream, section, m_meshes[meshNo], codec.get(),
+                                      section.index < meshBounds.size() ? meshBounds[section.index] : Bounds{} ) )
+                    return;
+                break;
+            case ContainerSectionType::Material:
+                if ( meshNo >= m_meshes.size() )
+                    return;
+                m_meshes[meshNo].materialNo = RegisterMaterial(
+                    m_materials, LoadMaterialBinary( fileStream, directory, m_arena.get() ) );
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    //Rei`ZNVe[u烁bVƂɕɓǂݍ
+    //ubNkꂽZNV͐ɑSẴubNɓWJ
+    void LoadContainerParallel(const MappedFileStream& file, const std::string& directory, ThreadPool& threadPool)
+    {
+        ContainerView container;
+        if ( !container.Load( file.GetData(), file.GetSize(), ContainerKind::Model, &threadPool ) )
+            return;
+        const auto* info = container.Find( ContainerSectionType::ModelInfo, 0 );
+        if ( info == nullptr )
+            return;
+        auto infoStream = container.GetStream( *info );
+        short vertexFormat;
+        infoStream.Read( &vertexFormat, sizeof( short ) );
+        uint16_t modelCount;
+        infoStream.Read( &modelCount, sizeof( uint16_t ) );
+
+        //tH[}bgG[`FbN
+        uint32_t encoding = 0;
+        container.ReadSection( ContainerSectionType::VertexEncoding, 0, encoding );
+        std::unique_ptr<VertexCodec> codec;
+        if ( !CreateVertexCodec( vertexFormat, static_cast<int>( encoding ), codec ) )
+            return;
+        const auto* activeCodec = codec.get();
+
+        const auto firstMesh = m_meshes.size();
+        std::vector<Material> materials;
+        m_meshes.reserve( firstMesh + modelCount );
+        m_materials.reserve( m_materials.size() + modelCount );
+        materials.reserve( modelCount );
+        for ( auto i = 0; i < modelCount; i++ )
+        {
+            m_meshes.emplace_back( m_arena.get() );
+            materials.emplace_back( m_arena.get() );
+        }
+        std::atomic<bool> failed( false );
+        threadPool.ParallelFor( modelCount, [&](const std::size_t i)
+        {
+            const auto index = static_cast<uint32_t>( i );
+            Bounds bounds{};
+            container.ReadSection( ContainerSectionType::Bounds, index, bounds );
+            for ( const auto type : {
+                      ContainerSectionType::Vertices, ContainerSectionType::CompressedVertices,
+                      ContainerSectionType::PositionStream, ContainerSectionType::AttributeStream,
+                      ContainerSectionType::Indexes, ContainerSectionType::ShortIndexes, ContainerSectionType::CompressedIndexes,
+                      ContainerSectionType::MeshBounds
+                  } )
+            {
+                if ( const auto* section = container.Find( type, index ) )
+                {
+                    auto meshStream = container.GetStream( *section );
+                    if ( !LoadMeshSection( meshStream, *section, m_meshes[firstMesh + i], activeCodec, bounds ) )
+                        failed = true;
+                }
+            }
+            if ( const auto* section = container.Find( ContainerSectionType::Material, index ) )
+            {
+                auto materialStream = container.GetStream( *section );
+                materials[i] = LoadMaterialBinary( materialStream, directory, m_arena.get() );
+            }
+        } );
+
+        //ǂݍ߂ȂZNVꍇ͒ǂݍ݂ƓsAǉbV菜ă}eAo^Ȃ
+        if ( failed )
+        {
+            m_meshes.resize( firstMesh );
+            return;
+        }
+
+        //}eA̓̓t@CɍsAǂݍ݂Ɠԍɂ
+        for ( auto i = 0; i < modelCount; i++ )
+            m_meshes[firstMesh + i].materialNo = RegisterMaterial( m_materials, std::move( materials[i] ) );
+    }
+
+    //t@C̒_Xɕϊcodec(̂܂ܓǂݍ߂ꍇ͋ɂ)
+    //тw肹XvfLqȂꍇ͒_tH[}bgX̃TCYvȂfalseԂ
+    bool CreateVertexCodec(const int vertexFormat, const int encoding, std::unique_ptr<VertexCodec>& codec) const
+    {
+        codec.reset();
+        //vfLq^̓t@C̒_tH[}bgقȂĂvfƂɕϊ
+        const auto reflected = VertexReflection<X>::enabled && m_vertexLayout.empty();
+        if ( !reflected && m_vertexLayout.empty() && !CheckVertexFormat<X>( vertexFormat, 0 ) )
+            return false;
+        const auto* layout = m_vertexLayout.empty() ? nullptr : &m_vertexLayout;
+        if constexpr ( VertexReflection<X>::enabled )
+        {
+            if ( reflected )
+                layout = &VertexReflection<X>::GetLayout();
+        }
+        codec = std::make_unique<VertexCodec>( vertexFormat, encoding, false, layout );
+        if ( codec->IsIdentity() )
+        {
+            codec.reset();
+            return true;
+        }
+        if constexpr ( VertexReflection<X>::enabled )
+        {
+            if ( reflected )
+                codec->Specialize<X>();
+        }
+        return true;
+    }
+
+    //_CfbNX̃ZNVǂݍ(vf̓ZNṼTCY狁߂)
+    //codecΒ_WJ
+    template <class Stream>
+    static bool LoadMeshSection(Stream& fileStream, const ContainerSection& section, Mesh& model,
+                                const VertexCodec* codec, const Bounds& bounds)
+    {
+        switch ( static_cast<ContainerSectionType>( section.type ) )
+        {
+        case ContainerSectionType::Vertices:
+            if ( codec != nullptr )
+                return DecodeVertexSection( fileStream, section, *codec, bounds, model.vertexDatas );
+            if ( section.size % sizeof( X ) != 0 )
+                return false;
+            model.vertexDatas.resize( static_cast<std::size_t>( section.size / sizeof( X ) ) );
+            if ( section.size != 0 )
+                fileStream.Read( model.vertexDatas.data(), static_cast<int>( section.size ) );
+            CopyCounter::AddVertexBytes( static_cast<std::size_t>( section.size ) );
+            return true;
+        case ContainerSectionType::Indexes:
+            if ( section.size % sizeof( uint32_t ) != 0 )
+                return false;
+            ReadIndexes( fileStream, static_cast<std::size_t>( section.size / sizeof( uint32_t ) ),
+                         model.GetVertexCount(), model.indexes );
+            return true;
+        case ContainerSectionType::ShortIndexes:
+            if ( section.size % sizeof( uint16_t ) != 0 )
+                return false;
+            model.indexes.Resize( static_cast<std::size_t>( section.size / sizeof( uint16_t ) ), 0 );
+            if ( section.size != 0 )
+                fileStream.Read( model.indexes.GetBytes(), static_cast<int>( section.size ) );
+            return true;
+        case ContainerSectionType::CompressedVertices:
+            return DecompressVertexSection( fileStream, section, codec, bounds, model.vertexDatas );
+        case ContainerSectionType::CompressedIndexes:
+            return DecompressIndexSection( fileStream, section, model.GetVertexCount(), model.indexes );
+        case ContainerSectionType::PositionStream:
+            return ReadVertexStream( fileStream, section, sizeof( Float3 ), model.positions ) &&
+                DecodeVertexStreams( codec, model.positions, model.attributes, nullptr, model.vertexDatas );
+        case ContainerSectionType::AttributeStream:
+            //Xɕϊꍇ̓t@C̕т̂܂ܓǂݍ݁AXg[Ă܂Ƃ߂ĕϊ
+            if ( codec != nullptr )
+                return ReadVertexStream( fileStream, section, 1, model.attributes ) &&
+                    DecodeVertexStreams( codec, model.positions, model.attributes, nullptr, model.vertexDatas );
+            return ReadVertexStream( fileStream, section, Mesh::AttributeStride, model.attributes ) &&
+                model.attributes.size() == Mesh::AttributeStride * model.positions.size();
+        case ContainerSectionType::MeshBounds:
+            if ( section.size != sizeof( MeshBounds ) )
+                return false;
+            fileStream.Read( &model.meshBounds, sizeof( MeshBounds ) );
+            return true;
+        default:
+            return true;
+        }
+    }
+
+    template <class Stream>
+    static void LoadMeshBinary(Stream& fileStream, Mesh& model, const VertexCodec* codec)
+    {
+        //_ǂݍ
+        uint32_t vertexCount;
+        fileStream.Read( &vertexCount, sizeof( uint32_t ) );
+        model.vertexDatas.resize( vertexCount );
+        if ( codec != nullptr )
+        {
+            std::vector<char> scratch;
+            const auto* src = ReadSectionData( fileStream, codec->GetPackedVertexSize() * vertexCount, scratch );
+            codec->Decode( src, vertexCount, Bounds{}, model.vertexDatas.data() );
+        }
+        else
+            fileStream.Read( &model.vertexDatas[0], sizeof( X ) * vertexCount );
+        CopyCounter::AddVertexBytes( sizeof( X ) * vertexCount );
+
+        //CfbNXǂݍ
+        uint32_t indexCount;
+        fileStream.Read( &indexCount, sizeof( uint32_t ) );
+        ReadIndexes( fileStream, indexCount, vertexCount, model.indexes );
+    }
+};
+
+template <class X>
+struct SkinnedModel
+{
+private:
+    //Kw\܂߂ēǂݍ񂾃f[^͑SẴA[imۂASkinnedModel̔jɂ܂Ƃ߂ĉ
+    std::unique_ptr<Arena> m_arena = std::make_unique<Arena>();
+    VertexLayout m_vertexLayout; //Ȃt@C̒_tH[}bgXvĂKv
+
+public:
+    struct Mesh
+    {
+        Mesh() = default;
+
+        explicit Mesh(std::pmr::memory_resource* resource)
+            : vertexDatas( resource ), positions( resource ), attributes( resource ), skins( resource ),
+              indexes( resource ), bones( resource ), boneBounds( resource )
+        {
+        }
+
+        //_f[^ÖقɃRs[Ȃ悤[û݋
+        Mesh(Mesh&&) = default;
+        Mesh& operator=(Mesh&&) = default;
+        Mesh(const Mesh&) = delete;
+        Mesh& operator=(const Mesh&) = delete;
+
+        std::size_t GetVertexCount() const
+        {
+            return positions.empty() ? vertexDatas.size() : positions.size();
+        }
+
+        //1_attributes̃oCg(XʒuBoneIndex & BoneWeight)
+        static constexpr std::size_t AttributeStride = sizeof( X ) - sizeof( Float3 ) - sizeof( VertexSkin );
+
+        std::pmr::vector<X> vertexDatas;
+        //_Xg[ɕt@CłvertexDatas͋ŁAɓǂݍ
+        std::pmr::vector<Float3> positions;
+        std::pmr::vector<char> attributes;
+        std::pmr::vector<VertexSkin> skins;
+        IndexArray indexes;
+        std::pmr::vector<std::pair<Matrix, Transform*>> bones;
+        //ϊɌvZJOp̋E(Rei`̂݁A`ł0̂܂)
+        MeshBounds meshBounds{};
+        //bonesƓт̃oChԂBounds(e钸_{[min > max)
+        std::pmr::vector<Bounds> boneBounds;
+        int materialNo;
+    };
+
+    std::vector<Mesh> m_meshes;
+    std::vector<Material> m_materials;
+    ResourcePtr<Transform> m_root;
+    TransformMap m_transformMap{ m_arena.get() };
+
+    SkinnedModel() = default;
+
+    SkinnedModel(SkinnedModel&& other)
+    {
+        *this = std::move( other );
+    }
+
+    SkinnedModel& operator=(SkinnedModel&& other)
+    {
+        if ( this != &other )
+        {
+            m_vertexLayout = std::move( other.m_vertexLayout );
+            m_meshes = std::move( other.m_meshes );
+            m_materials = std::move( other.m_materials );
+            m_root = std::move( other.m_root );
+            MoveResourceMember( m_transformMap, std::move( other.m_transformMap ) );
+            m_arena = std::exchange( other.m_arena, std::make_unique<Arena>() );
+            ResetResourceMember( other.m_transformMap, other.m_arena.get() );
+        }
+        return *this;
+    }
+
+    //X̗vf̕тw肷ƁA_tH[}bgXƈقȂt@CvfƂɕϊēǂݍ
+    //Xɖvf͎̂āAt@CɖvfX̊l̂܂܂ɂ(ModelViewȂǂ̃r[ɂ͎gȂ)
+    bool SetVertexLayout(const VertexLayout& layout)
+    {
+        if ( !CheckVertexSize<X>( layout.stride ) || !layout.IsValid() )
+            return false;
+        m_vertexLayout = layout;
+        return true;
+    }
+
+private:
+    void LoadHierarchyAscii(AsciiTokenizer& tokenizer)
+    {
+        //f̊Kw\ǂݍ
+        auto active = m_root.get();
+        auto transformCount = 0;
+        {
+            const auto tmp = tokenizer.ReadStringView();
+            transformCount++;
+            active->m_name = tmp;
+            active->m_hash = std::hash<std::string_view>()( tmp );
+            tokenizer.Read( &active->m_position.x, 3 );
+            Float3 euler;
+            tokenizer.Read( &euler.x, 3 );
+            active->m_rotation = MakeQuaternion( euler );
+            tokenizer.Read( &active->m_scale.x, 3 );
+        }
+        while ( transformCount != 0 )
+        {
+            const auto tmp = tokenizer.ReadStringView();
+            if ( tmp == "ChildEndTransform" )
+            {
+                transformCount--;
+                active = active->m_parent;
+                continue;
+            }
+            transformCount++;
+            auto newTrans = MakeResourcePtr<Transform>( m_arena.get() );
+            newTrans->m_name = tmp;
+            newTrans->m_hash = std::hash<std::string_view>()( tmp );
+            tokenizer.Read( &newTrans->m_position.x, 3 );
+
+            Float3 euler;
+            tokenizer.Read( &euler.x, 3 );
+            newTrans->m_rotation = MakeQuaternion( euler );
+            tokenizer.Read( &newTrans->m_scale.x, 3 );
+            newTrans->m_parent = active;
+            active->m_child.push_back( newTrans.get() );
+            active = newTrans.get();
+            m_transformMap.insert( std::make_pair( newTrans->m_hash, std::move( newTrans ) ) );
+        }
+    }
+
+    void LoadAsciiFile(std::string& filename, ThreadPool* threadPool)
+    {
+        m_root = MakeResourcePtr<Transform>( m_arena.get() );
+
+        MappedFileStream file( filename.c_str() );
+        auto lastSlash = filename.find_last_of( '/' );
+        filename.erase( lastSlash );
+        assert( file.IsOpen() );
+        AsciiTokenizer tokenizer( file.GetData(), file.GetSize() );
+        std::unique_ptr<AsciiTokenIndex> tokenIndex;
+        if ( threadPool != nullptr )
+            tokenIndex = std::make_unique<AsciiTokenIndex>( file.GetData(), file.GetSize(), *threadPool );
+
+        LoadHierarchyAscii( tokenizer );
+
+        //_tH[}bgǂݍ
+        const auto vertexFormat = tokenizer.Read<int>();
+        const auto modelCount = tokenizer.Read<int>();
+
+        //tH[}bgG[`FbN
+        std::unique_ptr<VertexCodec> codec;
+        if ( !CreateVertexCodec( vertexFormat, 0, codec ) )
+            return;
+
+        //BoneIndex & BoneWeightO̗vf͑Sfloat
+        const std::size_t vertexSize = GetVertexFormatSize( vertexFormat ) + 32;
+        const auto attributeCount = GetVertexFormatSize( vertexFormat ) / sizeof( float );
+        m_meshes.reserve( m_meshes.size() + modelCount );
+        m_materials.reserve( m_materials.size() + modelCount );
+        for ( auto i = 0; i < modelCount; i++ )
+        {
+            auto& model = m_meshes.emplace_back( m_arena.get() );
+            //_ǂݍ
+            //Xɕϊꍇ̓t@C̕тœǂݍł܂Ƃ߂ĕϊ
+            const auto vertexCount = tokenizer.Read<int>();
+            model.vertexDatas.resize( vertexCount );
+            std::vector<char> records( codec != nullptr ? vertexSize * vertexCount : 0 );
+            auto* dst = codec != nullptr ? records.data() : reinterpret_cast<char*>( model.vertexDatas.data() );
+            ReadAsciiRecords( tokenizer, vertexCount, attributeCount + 8, tokenIndex.get(), threadPool,
+                              [dst, vertexSize, attributeCount](AsciiTokenizer& recordTokenizer, const std::size_t j)
+                              {
+                                  uint8_t rawData[MaxVertexFormatSize + 32];
+                                  float attributes[MaxVertexFormatSize / sizeof( float ) + 1];
+                                  recordTokenizer.Read( attributes, attributeCount );
+                                  memcpy( rawData, attributes, attributeCount * sizeof( float ) );
+                                  Int4 boneIndex;
+                                  Float4 boneWeight;
+                                  recordTokenizer.Read( &boneIndex.x, 4 );
+                                  recordTokenizer.Read( &boneWeight.x, 4 );
+                                  memcpy( &rawData[vertexSize - 32], &boneIndex, 16 );
+                                  memcpy( &rawData[vertexSize - 16], &boneWeight, 16 );
+                                  memcpy( dst + vertexSize * j, rawData, vertexSize );
+                              } );
+            if ( codec != nullptr )
+                codec->Decode( records.data(), vertexCount, Bounds{}, model.vertexDatas.data() );
+            CopyCounter::AddVertexBytes( sizeof( X ) * vertexCount );
+
+            //CfbNXǂݍ
+            const auto indexCount = tokenizer.Read<int>();
+            model.indexes.Resize( indexCount, model.vertexDatas.size() );
+            ReadAsciiRecords( tokenizer, indexCount, 1, tokenIndex.get(), threadPool,
+                              [&model](AsciiTokenizer& recordTokenizer, const std::size_t j)
+                              {
+                                  uint32_t index;
+                                  recordTokenizer.Read( index );
+                                  model.indexes.Set( j, index );
+                              } );
+
+            //x[X|[Yǂݍ
+            const auto basePoseCount = tokenizer.Read<int>();
+            model.bones.reserve( basePoseCount );
+            std::string name;
+            for ( auto j = 0; j < basePoseCount; j++ )
+            {
+                name = tokenizer.ReadStringView();
+
+                float tmp[16];
+                tokenizer.Read( tmp, 16 );
+
+                auto trans = m_root->Find( name );
+                model.bones.push_back( std::make_pair(
+                    Matrix{
+                        tmp[0], tmp[4], tmp[8], tmp[12],
+                        tmp[1], tmp[5], tmp[9], tmp[13],
+                        tmp[2], tmp[6], tmp[10], tmp[14],
+                        tmp[3], tmp[7], tmp[11], tmp[15]
+                    }, trans ) );
+            }
+
+            //}eA̓ǂݍ
+            model.materialNo = RegisterMaterial( m_materials, LoadMaterialAscii( tokenizer, filename, m_arena.get() ) );
+        }
+    }
+
+public:
+    void LoadAscii(std::string filename)
+    {
+        LoadAsciiFile( filename, nullptr );
+    }
+
+    //_ƃCfbNX̐lϊXbhv[ŕɍs(ʂLoadAsciiƓ)
+    void LoadAsciiParallel(std::string filename, ThreadPool& threadPool = ThreadPool::GetDefault())
+    {
+        LoadAsciiFile( filename, &threadPool );
+    }
+
+    void LoadBinary(std::string filename)
+    {
+        FileStream fileStream( filename.c_str() );
+        auto lastSlash = filename.find_last_of( '/' );
+        filename.erase( lastSlash );
+        LoadBinaryStream( fileStream, filename );
+    }
+
+    //I/Oobt@bufferTCYɗ}ēǂݍ
+    //t@CJȂrŐ؂ĂꍇfalseԂ(ǂݍ񂾓e͎gȂ)
+    bool LoadBinary(std::string filename, const std::size_t bufferSize)
+    {
+        StreamingFileStream fileStream( filename.c_str(), bufferSize );
+        if ( !fileStream.IsOpen() )
+            return false;
+        auto lastSlash = filename.find_last_of( '/' );
+        filename.erase( lastSlash );
+        LoadBinaryStream( fileStream, filename );
+        return !fileStream.IsFailed();
+    }
+
+    //Read(void*, int)Cӂ̃Xg[ǂݍ
+    //`ƃRei`̂ǂǂݍ߂
+    template <class Stream>
+    void LoadBinaryStream(Stream& stream, const std::string& directory)
+    {
+        ContainerStream<Stream> fileStream( stream );
+        if ( fileStream.IsContainer() )
+        {
+            LoadContainerStream( fileStream, directory );
+            return;
+        }
+
+        m_root = MakeResourcePtr<Transform>( m_arena.get() );
+
+        LoadHierarchyBinary( fileStream, m_root.get(), m_transformMap );
+
+        short vertexFormat;
+        fileStream.Read( &vertexFormat, sizeof( short ) );
+
+        uint16_t modelCount;
+        fileStream.Read( &modelCount, sizeof( uint16_t ) );
+
+        //tH[}bgG[`FbN
+        std::unique_ptr<VertexCodec> codec;
+        if ( !CreateVertexCodec( vertexFormat, 0, codec ) )
+            return;
+
+        //wb_[̃bVŊmۂĂAbV͔zɒړǂݍ
+        m_meshes.reserve( m_meshes.size() + modelCount );
+        m_materials.reserve( m_materials.size() + modelCount );
+        for ( auto i = 0; i < modelCount; i++ )
+        {
+            auto& model = m_meshes.emplace_back( m_arena.get() );
+            LoadMeshBinary( fileStream, model, m_root.get(), codec.get() );
+
+            //}eA̓ǂݍ
+            model.materialNo = RegisterMaterial( m_materials, LoadMaterialBinary( fileStream, directory, m_arena.get() ) );
+        }
+    }
+
+    //Rei`bVItZbge[u΃bVƂɃXbhv[ŕɓǂݍ
+    //Kw\͐擪璀ǂݍ݁Ae[ut@C͒ʏ̓ǂݍ݂s
+    void LoadBinaryParallel(std::string filename, ThreadPool& threadPool = ThreadPool::GetDefault())
+    {
+        MappedFileStream file;
+        if ( !file.Load( filename.c_str() ) )
+            return;
+        auto lastSlash = filename.find_last_of( '/' );
+        filename.erase( lastSlash );
+        if ( IsContainerData( file.GetData(), file.GetSize() ) )
+        {
+            LoadContainerParallel( file, filename, threadPool );
+            return;
+        }
+
+        MemoryStream headerStream( file.GetData(), file.GetSize() );
+        SkipHierarchyBinary( headerStream );
+        short vertexFormat;
+        headerStream.Read( &vertexFormat, sizeof( short ) );
+        uint16_t modelCount;
+        headerStream.Read( &modelCount, sizeof( uint16_t ) );
+
+        std::vector<uint64_t> offsets;
+        MemoryStream fileStream( file.GetData(), file.GetSize() );
+        if ( !ReadMeshOffsetTable( file.GetData(), file.GetSize(), modelCount, offsets ) )
+        {
+            LoadBinaryStream( fileStream, filename );
+            return;
+        }
+
+        m_root = MakeResourcePtr<Transform>( m_arena.get() );
+        LoadHierarchyBinary( fileStream, m_root.get(), m_transformMap );
+
+        //tH[}bgG[`FbN
+        std::unique_ptr<VertexCodec> codec;
+        if ( !CreateVertexCodec( vertexFormat, 0, codec ) )
+            return;
+
+        //Kw\͓ǂݍݍς݂Ȃ̂ŊeXbhFindĂȂ
+        //bV͔zɒړǂݍ݁A}eApɈꎞz֓ǂ
+        const auto firstMesh = m_meshes.size();
+        std::vector<Material> materials;
+        m_meshes.reserve( firstMesh + modelCount );
+        m_materials.reserve( m_materials.size() + modelCount );
+        materials.reserve( modelCount );
+        for ( auto i = 0; i < modelCount; i++ )
+        {
+            m_meshes.emplace_back( m_arena.get() );
+            materials.emplace_back( m_arena.get() );
+        }
+        auto* root = m_root.get();
+        threadPool.ParallelFor( modelCount, [&](const std::size_t i)
+        {
+            MemoryStream meshStream( file.GetData() + offsets[i], file.GetSize() - offsets[i] );
+            LoadMeshBinary( meshStream, m_meshes[firstMesh + i], root, codec.get() );
+            materials[i] = LoadMaterialBinary( meshStream, filename, m_arena.get() );
+        } );
+
+        //}eA̓̓t@CɍsAǂݍ݂Ɠԍɂ
+        for ( auto i = 0; i < modelCount; i++ )
+        {
+            m_meshes[firstMesh + i].materialNo = RegisterMaterial( m_materials, std::move( materials[i] ) );
+        }
+    }
+
+private:
+    //Rei`ZNVe[ȕɓǂݍ
+    template <class Stream>
+    void LoadContainerStream(ContainerStream<Stream>& fileStream, const std::string& directory)
+    {
+        std::vector<ContainerSection> sections;
+        if ( !ReadContainerHeader( fileStream, ContainerKind::SkinnedModel, sections ) )
+            return;
+
+        m_root = MakeResourcePtr<Transform>( m_arena.get() );
+        const auto firstMesh = m_meshes.size();
+        auto checked = false;
+        short vertexFormat = 0;
+        std::unique_ptr<VertexCodec> codec;
+        std::vector<Bounds> meshBounds;
+        for ( const auto& entry : sections )
+        {
+            ContainerSection section;
+            if ( !fileStream.BeginSection( entry, section ) )
+                return;
+            const auto meshNo = firstMesh + section.index;
+            switch ( static_cast<ContainerSectionType>( section.type ) )
+            {
+            case ContainerSectionType::Hierarchy:
+                LoadHierarchyBinary( fileStream, m_root.get(), m_transformMap );
+                break;
+            case ContainerSectionType::ModelInfo:
+                {
+                    fileStream.Read( &vertexFormat, sizeof( short ) );
+                    uint16_t modelCount;
+                    fileStream.Read( &modelCount, sizeof( uint16_t ) );
+
+                    //tH[}bgG[`FbN
+                    if ( !CreateVertexCodec( vertexFormat, 0, codec ) )
+                        return;
+                    m_meshes.reserve( firstMesh + modelCount );
+                    m_materials.reserve( m_materials.size() + modelCount );
+                    meshBounds.resize( modelCount );
+                    checked = true;
+                    break;
+                }
+            case ContainerSectionType::VertexEncoding:
+                {
+                    if ( !checked )
+                        return;
+                    uint32_t encoding;
+                    fileStream.Read( &encoding, sizeof( uint32_t ) );
+                    if ( !CreateVertexCodec( vertexFormat, static_cast<int>( encoding ), codec ) )
+                        return;
+                    break;
+                }
+            case ContainerSectionType::Bounds:
+                if ( section.index >= meshBounds.size() )
+                    return;
+                fileStream.Read( &meshBounds[section.index], sizeof( Bounds ) );
+                break;
+            case ContainerSectionType::Vertices:
+            case ContainerSectionType::Indexes:
+            case ContainerSectionType::ShortIndexes:
+            case ContainerSectionType::CompressedVertices:
+            case ContainerSectionType::CompressedIndexes:
+            case ContainerSectionType::PositionStream:
+            case ContainerSectionType::AttributeStream:
+            case ContainerSectionType::SkinStream:
+            case ContainerSectionType::MeshBounds:
+            case ContainerSectionType::BindPoses:
+            case ContainerSectionType::BoneBounds:
+                //bV͒_̃ZNVŒǉ
+                if ( !checked )
+                    return;
+                if ( meshNo == m_meshes.size() )
+                    m_meshes.emplace_back( m_arena.get() );
+                if ( meshNo >= m_meshes.size() ||
+                    !LoadMeshSection( fileStream, section, m_meshes[meshNo], m_root.get(), codec.get(),
+                                      section.index < meshBounds.size() ? meshBounds[section.index] : Bounds{} ) )
+                    return;
+                break;
+            case ContainerSectionType::Material:
+                if ( meshNo >= m_meshes.size() )
+                    return;
+                m_meshes[meshNo].materialNo = RegisterMaterial(
+                    m_materials, LoadMaterialBinary( fileStream, directory, m_arena.get() ) );
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    //Rei`ZNVe[u烁bVƂɕɓǂݍ
+    //ubNkꂽZNV͐ɑSẴubNɓWJ
+    //Kw\͐ɓǂݍނ̂ŊeXbhFindĂȂ
+    void LoadContainerParallel(const MappedFileStream& file, const std::string& directory, ThreadPool& threadPool)
+    {
+        ContainerView container;
+        if ( !container.Load( file.GetData(), file.GetSize(), ContainerKind::SkinnedModel, &threadPool ) )
+            return;
+        const auto* hierarchy = container.Find( ContainerSectionType::Hierarchy, 0 );
+        const auto* info = container.Find( ContainerSectionType::ModelInfo, 0 );
+        if ( hierarchy == nullptr || info == nullptr )
+            return;
+        m_root = MakeResourcePtr<Transform>( m_arena.get() );
+        auto hierarchyStream = container.GetStream( *hierarchy );
+        LoadHierarchyBinary( hierarchyStream, m_root.get(), m_transformMap );
+
+        auto infoStream = container.GetStream( *info );
+        short vertexFormat;
+        infoStream.Read( &vertexFormat, sizeof( short ) );
+        uint16_t modelCount;
+        infoStream.Read( &modelCount, sizeof( uint16_t ) );
+
+        //tH[}bgG[`FbN
+        uint32_t encoding = 0;
+        container.ReadSection( ContainerSectionType::VertexEncoding, 0, encoding );
+        std::unique_ptr<VertexCodec> codec;
+        if ( !CreateVertexCodec( vertexFormat, static_cast<int>( encoding ), codec ) )
+            return;
+        const auto* activeCodec = codec.get();
+
+        const auto firstMesh = m_meshes.size();
+        std::vector<Material> materials;
+        m_meshes.reserve( firstMesh + modelCount );
+        m_materials.reserve( m_materials.size() + modelCount );
+        materials.reserve( modelCount );
+        for ( auto i = 0; i < modelCount; i++ )
+        {
+            m_meshes.emplace_back( m_arena.get() );
+            materials.emplace_back( m_arena.get() );
+        }
+        auto* root = m_root.get();
+        std::atomic<bool> failed( false );
+        threadPool.ParallelFor( modelCount, [&](const std::size_t i)
+        {
+            const auto index = static_cast<uint32_t>( i );
+            Bounds bounds{};
+            container.ReadSection( ContainerSectionType::Bounds, index, bounds );
+            for ( const auto type : {
+                      ContainerSectionType::Vertices, ContainerSectionType::CompressedVertices,
+                      ContainerSectionType::PositionStream, ContainerSectionType::AttributeStream,
+                      ContainerSectionType::SkinStream, ContainerSectionType::Indexes, ContainerSectionType::ShortIndexes,
+                      ContainerSectionType::CompressedIndexes, ContainerSectionType::MeshBounds, ContainerSectionType::BindPoses,
+                      ContainerSectionType::BoneBounds
+                  } )
+            {
+                if ( const auto* section = container.Find( type, index ) )
+                {
+                    auto meshStream = container.GetStream( *section );
+                    if ( !LoadMeshSection( meshStream, *section, m_meshes[firstMesh + i], root, activeCodec, bounds ) )
+                        failed = true;
+                }
+            }
+            if ( const auto* section = container.Find( ContainerSectionType::Material, index ) )
+            {
+                auto materialStream = container.GetStream( *section );
+                materials[i] = LoadMaterialBinary( materialStream, directory, m_arena.get() );
+            }
+        } );
+
+        //ǂݍ߂ȂZNVꍇ͒ǂݍ݂ƓsAǉbV菜ă}eAo^Ȃ
+        if ( failed )
+        {
+            m_meshes.resize( firstMesh );
+            return;
+        }
+
+        //}eA̓̓t@CɍsAǂݍ݂Ɠԍɂ
+        for ( auto i = 0; i < modelCount; i++ )
+            m_meshes[firstMesh + i].materialNo = RegisterMaterial( m_materials, std::move( materials[i] ) );
+    }
+
+    //t@C̒_Xɕϊcodec(̂܂ܓǂݍ߂ꍇ͋ɂ)
+    //тw肹XvfLqȂꍇ͒_tH[}bgX̃TCYvȂfalseԂ
+    bool CreateVertexCodec(const int vertexFormat, const int encoding, std::unique_ptr<VertexCodec>& codec) const
+    {
+        codec.reset();
+        //vfLq^̓t@C̒_tH[}bgقȂĂvfƂɕϊ
+        const auto reflected = VertexReflection<X>::enabled && m_vertexLayout.empty();
+        if ( !reflected && m_vertexLayout.empty() && !CheckVertexFormat<X>( vertexFormat, 32 ) ) //BoneIndex & BoneWeight
+            return false;
+        const auto* layout = m_vertexLayout.empty() ? nullptr : &m_vertexLayout;
+        if constexpr ( VertexReflection<X>::enabled )
+        {
+            if ( reflected )
+                layout = &VertexReflection<X>::GetLayout();
+        }
+        codec = std::make_unique<VertexCodec>( vertexFormat, encoding, true, layout );
+        if ( codec->IsIdentity() )
+        {
+            codec.reset();
+            return true;
+        }
+        if constexpr ( VertexReflection<X>::enabled )
+        {
+            if ( reflected )
+                codec->Specialize<X>();
+        }
+        return true;
+    }
+
+    //_ECfbNXEx[X|[ỸZNVǂݍ(vf̓ZNṼTCY狁߂)
+    //codecΒ_WJ
+    template <class Stream>
+    static bool LoadMeshSection(Stream& fileStream, const ContainerSection& section, Mesh& model, Transform* root,
+                                const VertexCodec* codec, const Bounds& bounds)
+    {
+        switch ( static_cast<ContainerSectionType>( section.type ) )
+        {
+        case ContainerSectionType::Vertices:
+            if ( codec != nullptr )
+                return DecodeVertexSection( fileStream, section, *codec, bounds, model.vertexDatas );
+            if ( section.size % sizeof( X ) != 0 )
+                return false;
+            model.vertexDatas.resize( static_cast<std::size_t>( section.size / sizeof( X ) ) );
+            if ( section.size != 0 )
+                fileStream.Read( model.vertexDatas.data(), static_cast<int>( section.size ) );
+            CopyCounter::AddVertexBytes( static_cast<std::size_t>( section.size ) );
+            return true;
+        case ContainerSectionType::Indexes:
+            if ( section.size % sizeof( uint32_t ) != 0 )
+                return false;
+            ReadIndexes( fileStream, static_cast<std::size_t>( section.size / sizeof( uint32_t ) ),
+                         model.GetVertexCount(), model.indexes );
+            return true;
+        case ContainerSectionType::ShortIndexes:
+            if ( section.size % sizeof( uint16_t ) != 0 )
+                return false;
+            model.indexes.Resize( static_cast<std::size_t>( section.size / sizeof( uint16_t ) ), 0 );
+            if ( section.size != 0 )
+                fileStream.Read( model.indexes.GetBytes(), static_cast<int>( section.size ) );
+            return true;
+        case ContainerSectionType::CompressedVertices:
+            return DecompressVertexSection( fileStream, section, codec, bounds, model.vertexDatas );
+        case ContainerSectionType::CompressedIndexes:
+            return DecompressIndexSection( fileStream, section, model.GetVertexCount(), model.indexes );
+        case ContainerSectionType::PositionStream:
+            return ReadVertexStream( fileStream, section, sizeof( Float3 ), model.positions ) &&
+                DecodeVertexStreams( codec, model.positions, model.attributes, &model.skins, model.vertexDatas );
+        case ContainerSectionType::AttributeStream:
+            //Xɕϊꍇ̓t@C̕т̂܂ܓǂݍ݁AXg[Ă܂Ƃ߂ĕϊ
+            if ( codec != nullptr )
+                return ReadVertexStream( fileStream, section, 1, model.attributes ) &&
+                    DecodeVertexStreams( codec, model.positions, model.attributes, &model.skins, model.vertexDatas );
+            return ReadVertexStream( fileStream, section, Mesh::AttributeStride, model.attributes ) &&
+                model.attributes.size() == Mesh::AttributeStride * model.positions.size();
+        case ContainerSectionType::SkinStream:
+            return ReadVertexStream( fileStream, section, sizeof( VertexSkin ), model.skins ) &&
+                model.skins.size() == model.positions.size() &&
+                DecodeVertexStreams( codec, model.positions, model.attributes, &model.skins, model.vertexDatas );
+        case ContainerSectionType::MeshBounds:
+            if ( section.size != sizeof( MeshBounds ) )
+                return false;
+            fileStream.Read( &model.meshBounds, sizeof( MeshBounds ) );
+            return true;
+        case ContainerSectionType::BoneBounds:
+            if ( section.size % sizeof( Bounds ) != 0 )
+                return false;
+            model.boneBounds.resize( static_cast<std::size_t>( section.size / sizeof( Bounds ) ) );
+            if ( section.size != 0 )
+                fileStream.Read( model.boneBounds.data(), static_cast<int>( section.size ) );
+            return true;
+        case ContainerSectionType::BindPoses:
+            {
+                uint16_t basePoseCount;
+                fileStream.Read( &basePoseCount, sizeof( uint16_t ) );
+                model.bones.reserve( basePoseCount );
+                std::string name;
+                for ( auto j = 0; j < basePoseCount; j++ )
+                    model.bones.push_back( LoadBindPoseBinary( fileStream, root, name ) );
+                return true;
+            }
+        default:
+            return true;
+        }
+    }
+
+    template <class Stream>
+    static void LoadMeshBinary(Stream& fileStream, Mesh& model, Transform* root, const VertexCodec* codec)
+    {
+        //_ǂݍ
+        uint32_t vertexCount;
+        fileStream.Read( &vertexCount, sizeof( uint32_t ) );
+        model.vertexDatas.resize( vertexCount );
+        if ( codec != nullptr )
+        {
+            std::vector<char> scratch;
+            const auto* src = ReadSectionData( fileStream, codec->GetPackedVertexSize() * vertexCount, scratch );
+            codec->Decode( src, vertexCount, Bounds{}, model.vertexDatas.data() );
+        }
+        else
+            fileStream.Read( &model.vertexDatas[0], sizeof( X ) * vertexCount );
+        CopyCounter::AddVertexBytes( sizeof( X ) * vertexCount );
+
+        //CfbNXǂݍ
+        uint32_t indexCount;
+        fileStream.Read( &indexCount, sizeof( uint32_t ) );
+        ReadIndexes( fileStream, indexCount, vertexCount, model.indexes );
+
+        //x[X|[Yǂݍ
+        uint16_t basePoseCount;
+        fileStream.Read( &basePoseCount, sizeof( uint16_t ) );
+        model.bones.reserve( basePoseCount );
+        std::string name;
+        for ( auto j = 0; j < basePoseCount; j++ )
+            model.bones.push_back( LoadBindPoseBinary( fileStream, root, name ) );
+    }
+};
+
+//}bvt@C𒼐ڎQƂModel
+//_ƃCfbNX̓t@C̃f[^wŃRs[Ȃ
+template <class X>
+struct ModelView
+{
+private:
+    std::unique_ptr<Arena> m_arena = std::make_unique<Arena>();
+
+public:
+    struct Mesh
+    {
+        std::size_t GetVertexCount() const
+        {
+            return positions.empty() ? vertexDatas.size() : positions.size();
+        }
+
+        //1_attributes̃oCg(Xʒu)
+        static constexpr std::size_t AttributeStride = sizeof( X ) - sizeof( Float3 );
+
+        ArrayView<X> vertexDatas;
+        //_Xg[ɕt@CłvertexDatas͋ŁA炩w
+        ArrayView<Float3> positions;
+        ArrayView<char> attributes;
+        IndexView indexes;
+        Bounds bounds{}; //kꂽʒu̓WJɎg
+        //ϊɌvZJOp̋E(Rei`̂݁A`ł0̂܂)
+        MeshBounds meshBounds{};
+        int materialNo{};
+    };
+
+    std::vector<Mesh> m_meshes;
+    std::vector<Material> m_materials;
+    MappedFileStream m_fileStream;
+    int m_vertexEncoding = 0; //EncodeFlg̑gݍ킹
+
+    ModelView() = default;
+
+    ModelView(ModelView&& other)
+    {
+        *this = std::move( other );
+    }
+
+    ModelView& operator=(ModelView&& other)
+    {
+        if ( this != &other )
+        {
+            m_meshes = std::move( other.m_meshes );
+            m_materials = std::move( other.m_materials );
+            m_fileStream = std::move( other.m_fileStream );
+            m_vertexEncoding = std::exchange( other.m_vertexEncoding, 0 );
+            m_arena = std::exchange( other.m_arena, std::make_unique<Arena>() );
+        }
+        return *this;
+    }
+
+    void LoadBinary(std::string filename)
+    {
+        if ( !m_fileStream.Load( filename.c_str() ) )
+            return;
+        auto lastSlash = filename.find_last_of( '/' );
+        filename.erase( lastSlash );
+        if ( IsContainerData( m_fileStream.GetData(), m_fileStream.GetSize() ) )
+        {
+            LoadContainer( filename );
+            return;
+        }
+
+        short vertexFormat;
+        m_fileStream.Read( &vertexFormat, sizeof( short ) );
+
+        uint16_t modelCount;
+        m_fileStream.Read( &modelCount, sizeof( uint16_t ) );
+
+        //tH[}bgG[`FbN
+        if ( !CheckVertexFormat<X>( vertexFormat, 0 ) )
+            return;
+
+        m_meshes.resize( modelCount );
+        for ( auto& model : m_meshes )
+        {
+            //_}bv
+            uint32_t vertexCount;
+            m_fileStream.Read( &vertexCount, sizeof( uint32_t ) );
+            model.vertexDatas.ptr = reinterpret_cast<const X*>( m_fileStream.Map( sizeof( X ) * vertexCount ) );
+            model.vertexDatas.count = vertexCount;
+
+            //CfbNX}bv
+            uint32_t indexCount;
+            m_fileStream.Read( &indexCount, sizeof( uint32_t ) );
+            model.indexes.ptr = m_fileStream.Map( sizeof( uint32_t ) * indexCount );
+            model.indexes.count = indexCount;
+
+            //}eA̓ǂݍ
+            model.materialNo = RegisterMaterial( m_materials, LoadMaterialBinary( m_fileStream, filename, m_arena.get() ) );
+        }
+    }
+
+private:
+    //Rei`̒_ƃCfbNX16byteEɑĂ̂ł̂܂܎w
+    //_kĂꍇ͈k̕тXƂĎwAWJ̓VF[_[ōs
+    //tkubNkꂽZNV̓A[iɓWJĂw
+    void LoadContainer(const std::string& directory)
+    {
+        ContainerView container;
+        if ( !container.Load( m_fileStream.GetData(), m_fileStream.GetSize(), ContainerKind::Model, nullptr, m_arena.get() ) )
+            return;
+        const auto* info = container.Find( ContainerSectionType::ModelInfo, 0 );
+        if ( info == nullptr )
+            return;
+        auto infoStream = container.GetStream( *info );
+        short vertexFormat;
+        infoStream.Read( &vertexFormat, sizeof( short ) );
+        uint16_t modelCount;
+        infoStream.Read( &modelCount, sizeof( uint16_t ) );
+
+        //tH[}bgG[`FbN
+        uint32_t encoding = 0;
+        container.ReadSection( ContainerSectionType::VertexEncoding, 0, encoding );
+        const VertexCodec codec( vertexFormat, static_cast<int>( encoding ), false );
+        if ( !CheckVertexSize<X>( codec.GetPackedVertexSize() ) )
+            return;
+        //vfLq^͈kĂȂꍇɒ_tH[}bgƕтm߂
+        if ( codec.GetEncoding() == 0 && !CheckVertexFormat<X>( vertexFormat, 0 ) )
+            return;
+        m_vertexEncoding = codec.GetEncoding();
+
+        m_meshes.resize( modelCount );
+        for ( uint32_t i = 0; i < modelCount; i++ )
+        {
+            auto& model = m_meshes[i];
+            if ( const auto* section = container.Find( ContainerSectionType::Vertices, i ) )
+            {
+                model.vertexDatas.ptr = reinterpret_cast<const X*>( container.GetData( *section ) );
+                model.vertexDatas.count = static_cast<std::size_t>( section->size / sizeof( X ) );
+            }
+            else if ( const auto* section = container.Find( ContainerSectionType::CompressedVertices, i ) )
+                DecompressVertexView( container, *section, m_arena.get(), model.vertexDatas );
+            else if ( MapVertexStream( container, ContainerSectionType::PositionStream, i, sizeof( Float3 ), model.positions ) )
+                MapVertexStream( container, ContainerSectionType::AttributeStream, i, Mesh::AttributeStride, model.attributes );
+            container.ReadSection( ContainerSectionType::Bounds, i, model.bounds );
+            container.ReadSection( ContainerSectionType::MeshBounds, i, model.meshBounds );
+            if ( const auto* section = container.Find( ContainerSectionType::Indexes, i ) )
+            {
+                model.indexes.ptr = container.GetData( *section );
+                model.indexes.count = static_cast<std::size_t>( section->size / sizeof( uint32_t ) );
+            }
+            else if ( const auto* section = container.Find( ContainerSectionType::ShortIndexes, i ) )
+            {
+                model.indexes = IndexView{
+                    container.GetData( *section ), static_cast<std::size_t>( section->size / sizeof( uint16_t ) ),
+                    sizeof( uint16_t )
+                };
+            }
+            else if ( const auto* section = container.Find( ContainerSectionType::CompressedIndexes, i ) )
+                DecompressIndexView( container, *section, model.GetVertexCount(), m_arena.get(), model.indexes );
+            if ( const auto* section = container.Find( ContainerSectionType::Material, i ) )
+            {
+                auto materialStream = container.GetStream( *section );
+                model.materialNo = RegisterMaterial( m_materials, LoadMaterialBinary( materialStream, directory, m_arena.get() ) );
+            }
+        }
+    }
+};
+
+//}bvt@C𒼐ڎQƂSkinnedModel
+template <class X>
+struct SkinnedModelView
+{
+private:
+    std::unique_ptr<Arena> m_arena = std::make_unique<Arena>();
+
+public:
+    struct Mesh
+    {
+        Mesh() = default;
+
+        explicit Mesh(std::pmr::memory_resource* resource)
+            : bones( resource )
+        {
+        }
+
+        std::size_t GetVertexCount() const
+        {
+            return positions.empty() ? vertexDatas.size() : positions.size();
+        }
+
+        //1_attributes̃oCg(XʒuBoneIndex & BoneWeight)
+        static constexpr std::size_t AttributeStride = sizeof( X ) - sizeof( Float3 ) - sizeof( VertexSkin );
+
+        ArrayView<X> vertexDatas;
+        //_Xg[ɕt@CłvertexDatas͋ŁA炩w
+        ArrayView<Float3> positions;
+        ArrayView<char> attributes;
+        ArrayView<VertexSkin> skins;
+        IndexView indexes;
+        std::pmr::vector<std::pair<Matrix, Transform*>> bones;
+        Bounds bounds{}; //kꂽʒu̓WJɎg
+        //ϊɌvZJOp̋E(Rei`̂݁A`ł0̂܂)
+        MeshBounds meshBounds{};
+        //bonesƓт̃oChԂBounds(e钸_{[min > max)
+        ArrayView<Bounds> boneBounds;
+        int materialNo{};
+    };
+
+    std::vector<Mesh> m_meshes;
+    std::vector<Material> m_materials;
+    ResourcePtr<Transform> m_root;
+    TransformMap m_transformMap{ m_arena.get() };
+    MappedFileStream m_fileStream;
+    int m_vertexEncoding = 0; //EncodeFlg̑gݍ킹
+
+    SkinnedModelView() = default;
+
+    SkinnedModelView(SkinnedModelView&& other)
+    {
+        *this = std::move( other );
+    }
+
+    SkinnedModelView& operator=(SkinnedModelView&& other)
+    {
+        if ( this != &other )
+        {
+            m_meshes = std::move( other.m_meshes );
+            m_materials = std::move( other.m_materials );
+            m_root = std::move( other.m_root );
+            MoveResourceMember( m_transformMap, std::move( other.m_transformMap ) );
+            m_fileStream = std::move( other.m_fileStream );
+            m_vertexEncoding = std::exchange( other.m_vertexEncoding, 0 );
+            m_arena = std::exchange( other.m_arena, std::make_unique<Arena>() );
+            ResetResourceMember( other.m_transformMap, other.m_arena.get() );
+        }
+        return *this;
+    }
+
+    void LoadBinary(std::string filename)
+    {
+        if ( !m_fileStream.Load( filename.c_str() ) )
+            return;
+        m_root = MakeResourcePtr<Transform>( m_arena.get() );
+        auto lastSlash = filename.find_last_of( '/' );
+        filename.erase( lastSlash );
+        if ( IsContainerData( m_fileStream.GetData(), m_fileStream.GetSize() ) )
+        {
+            LoadContainer( filename );
+            return;
+        }
+
+        LoadHierarchyBinary( m_fileStream, m_root.get(), m_transformMap );
+
+        short vertexFormat;
+        m_fileStream.Read( &vertexFormat, sizeof( short ) );
+
+        uint16_t modelCount;
+        m_fileStream.Read( &modelCount, sizeof( uint16_t ) );
+
+        //tH[}bgG[`FbN
+        if ( !CheckVertexFormat<X>( vertexFormat, 32 ) ) //BoneIndex & BoneWeight
+            return;
+
+        m_meshes.reserve( modelCount );
+        for ( auto i = 0; i < modelCount; i++ )
+        {
+            auto& model = m_meshes.emplace_back( m_arena.get() );
+            //_}bv
+            uint32_t vertexCount;
+            m_fileStream.Read( &vertexCount, sizeof( uint32_t ) );
+            model.vertexDatas.ptr = reinterpret_cast<const X*>( m_fileStream.Map( sizeof( X ) * vertexCount ) );
+            model.vertexDatas.count = vertexCount;
+
+            //CfbNX}bv
+            uint32_t indexCount;
+            m_fileStream.Read( &indexCount, sizeof( uint32_t ) );
+            model.indexes.ptr = m_fileStream.Map( sizeof( uint32_t ) * indexCount );
+            model.indexes.count = indexCount;
+
+            //x[X|[Yǂݍ
+            uint16_t basePoseCount;
+            m_fileStream.Read( &basePoseCount, sizeof( uint16_t ) );
+            model.bones.reserve( basePoseCount );
+            std::string name;
+            for ( auto j = 0; j < basePoseCount; j++ )
+                model.bones.push_back( LoadBindPoseBinary( m_fileStream, m_root.get(), name ) );
+
+            //}eA̓ǂݍ
+            model.materialNo = RegisterMaterial( m_materials, LoadMaterialBinary( m_fileStream, filename, m_arena.get() ) );
+        }
+    }
+
+private:
+    //Rei`̒_ƃCfbNX16byteEɑĂ̂ł̂܂܎w
+    //_kĂꍇ͈k̕тXƂĎwAWJ̓VF[_[ōs
+    //tkubNkꂽZNV̓A[iɓWJĂw
+    void LoadContainer(const std::string& directory)
+    {
+        ContainerView container;
+        if ( !container.Load( m_fileStream.GetData(), m_fileStream.GetSize(), ContainerKind::SkinnedModel, nullptr, m_arena.get() ) )
+            return;
+        const auto* hierarchy = container.Find( ContainerSectionType::Hierarchy, 0 );
+        const auto* info = container.Find( ContainerSectionType::ModelInfo, 0 );
+        if ( hierarchy == nullptr || info == nullptr )
+            return;
+        auto hierarchyStream = container.GetStream( *hierarchy );
+        LoadHierarchyBinary( hierarchyStream, m_root.get(), m_transformMap );
+
+        auto infoStream = container.GetStream( *info );
+        short vertexFormat;
+        infoStream.Read( &vertexFormat, sizeof( short ) );
+        uint16_t modelCount;
+        infoStream.Read( &modelCount, sizeof( uint16_t ) );
+
+        //tH[}bgG[`FbN
+        uint32_t encoding = 0;
+        container.ReadSection( ContainerSectionType::VertexEncoding, 0, encoding );
+        const VertexCodec codec( vertexFormat, static_cast<int>( encoding ), true );
+        if ( !CheckVertexSize<X>( codec.GetPackedVertexSize() ) )
+            return;
+        //vfLq^͈kĂȂꍇɒ_tH[}bgƕтm߂
+        if ( codec.GetEncoding() == 0 && !CheckVertexFormat<X>( vertexFormat, 32 ) )
+            return;
+        m_vertexEncoding = codec.GetEncoding();
+
+        m_meshes.reserve( modelCount );
+        std::string name;
+        for ( uint32_t i = 0; i < modelCount; i++ )
+        {
+            auto& model = m_meshes.emplace_back( m_arena.get() );
+            if ( const auto* section = container.Find( ContainerSectionType::Vertices, i ) )
+            {
+                model.vertexDatas.ptr = reinterpret_cast<const X*>( container.GetData( *section ) );
+                model.vertexDatas.count = static_cast<std::size_t>( section->size / sizeof( X ) );
+            }
+            else if ( const auto* section = container.Find( ContainerSectionType::CompressedVertices, i ) )
+                DecompressVertexView( container, *section, m_arena.get(), model.vertexDatas );
+            else if ( MapVertexStream( container, ContainerSectionType::PositionStream, i, sizeof( Float3 ), model.positions ) )
+            {
+                MapVertexStream( container, ContainerSectionType::AttributeStream, i, Mesh::AttributeStride, model.attributes );
+                MapVertexStream( container, ContainerSectionType::SkinStream, i, sizeof( VertexSkin ), model.skins );
+            }
+            container.ReadSection( ContainerSectionType::Bounds, i, model.bounds );
+            container.ReadSection( ContainerSectionType::MeshBounds, i, model.meshBounds );
+            if ( const auto* section = container.Find( ContainerSectionType::BoneBounds, i ) )
+            {
+                model.boneBounds.ptr = reinterpret_cast<const Bounds*>( container.GetData( *section ) );
+                model.boneBounds.count = static_cast<std::size_t>( section->size / sizeof( Bounds ) );
+            }
+            if ( const auto* section = container.Find( ContainerSectionType::Indexes, i ) )
+            {
+                model.indexes.ptr = container.GetData( *section );
+                model.indexes.count = static_cast<std::size_t>( section->size / sizeof( uint32_t ) );
+            }
+            else if ( const auto* section = container.Find( ContainerSectionType::ShortIndexes, i ) )
+            {
+                model.indexes = IndexView{
+                    container.GetData( *section ), static_cast<std::size_t>( section->size / sizeof( uint16_t ) ),
+                    sizeof( uint16_t )
+                };
+            }
+            else if ( const auto* section = container.Find( ContainerSectionType::CompressedIndexes, i ) )
+                DecompressIndexView( container, *section, model.GetVertexCount(), m_arena.get(), model.indexes );
+            if ( const auto* section = container.Find( ContainerSectionType::BindPoses, i ) )
+            {
+                auto boneStream = container.GetStream( *section );
+                uint16_t basePoseCount;
+                boneStream.Read( &basePoseCount, sizeof( uint16_t ) );
+                model.bones.reserve( basePoseCount );
+                for ( auto j = 0; j < basePoseCount; j++ )
+                    model.bones.push_back( LoadBindPoseBinary( boneStream, m_root.get(), name ) );
+            }
+            if ( const auto* section = container.Find( ContainerSectionType::Material, i ) )
+            {
+                auto materialStream = container.GetStream( *section );
+                model.materialNo = RegisterMaterial( m_materials, LoadMaterialBinary( materialStream, directory, m_arena.get() ) );
+            }
+        }
+    }
+};
+
+//xCNς݃C[W
+//bVEKw\Ex[X|[YE}eA16byteEɑ̘Af[^ɔzu
+//QƂ͑SĎg̃AhX̑΃ItZbgȂ̂ŁAC[WǂɒuĂ|C^̏CvȂ
+//擪BakedModelHeaderAt@CTCYheader.sizeƈv
+static constexpr uint32_t BakedModelMagic = 0x4B424D55; //"UMBK"
+static constexpr uint32_t BakedModelVersion = 2;
+static constexpr std::size_t BakedModelAlignment = 16;
+
+// C[W̔zւ̎Q
+// offset͂̍\̎g̃AhX̃oCg
+template <class T>
+struct BakedArray
+{
+    int64_t offset;
+    uint64_t count;
+
+    const T* data() const
+    {
+        return reinterpret_cast<const T*>( reinterpret_cast<const char*>( this ) + offset );
+    }
+
+    std::size_t size() const
+    {
+        return static_cast<std::size_t>( count );
+    }
+
+    bool empty() const
+    {
+        return count == 0;
+    }
+
+    const T* begin() const
+    {
+        return data();
+    }
+
+    const T* end() const
+    {
+        return data() + count;
+    }
+
+    const T& operator[](const std::size_t index) const
+    {
+        return data()[index];
+    }
+};
+
+//͏I[0ނ̂c_strƂĂg
+struct BakedString : BakedArray<char>
+{
+    std::string_view GetStringView() const
+    {
+        return std::string_view( data(), size() );
+    }
+};
+
+//Kw\͐擪[g̍sŕׁAe͕KqOɂ
+struct BakedTransform
+{
+    BakedString name;
+    int32_t parent; //[g-1
+    int32_t reserved;
+    Float4 rotation; //NH[^jI
+    Float3 position;
+    Float3 scale;
+};
+
+//{[̎QƐ͖Oł͂ȂKw\̔ԍŎ
+struct BakedBone
+{
+    float bindPose[16]; //]uς(ǂݍ݌MatrixƓ)
+    int32_t transform; //Ȃꍇ-1
+    int32_t reserved[3];
+
+    Matrix GetBindPose() const
+    {
+        Matrix matrix;
+        std::memcpy( &matrix, bindPose, sizeof( float ) * 16 );
+        return matrix;
+    }
+};
+
+struct BakedColor
+{
+    BakedString property;
+    Float4 color;
+};
+
+struct BakedTexture
+{
+    BakedString property;
+    BakedString textureName; //f̃fBNg̑΃pX
+};
+
+//}eALoadBinaryƓOœς
+struct BakedMaterial
+{
+    BakedString name;
+    BakedArray<BakedColor> colors;
+    BakedArray<BakedTexture> textures;
+
+    Float4 GetColor(const std::string_view property) const
+    {
+        for ( const auto& color : colors )
+            if ( color.property.GetStringView() == property )
+                return color.color;
+        return Float4{};
+    }
+
+    const BakedTexture* FindTexture(const std::string_view property) const
+    {
+        for ( const auto& texture : textures )
+            if ( texture.property.GetStringView() == property )
+                return &texture;
+        return nullptr;
+    }
+};
+
+struct BakedMesh
+{
+    BakedArray<uint8_t> vertexDatas; //_̃oCg
+    BakedArray<uint32_t> indexes;
+    BakedArray<uint16_t> shortIndexes; //_ShortIndexVertexLimitȉȂindexes̑Ɏg
+    BakedArray<BakedBone> bones;
+    uint32_t vertexCount;
+    int32_t materialNo;
+};
+
+struct BakedModelHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t size;
+    int32_t vertexFormat;
+    uint32_t vertexSize;
+    uint32_t skinned;
+    uint32_t reserved;
+    BakedArray<BakedTransform> transforms;
+    BakedArray<BakedMesh> meshes;
+    BakedArray<BakedMaterial> materials;
+};
+
+// xCNς݃C[WgݗĂ
+// vf̈ʒu̓obt@ĊmۂĂςȂ悤擪̃ItZbgň
+class BakedImageWriter
+{
+public:
+    //alignmentEɑsizeoCgmۂA擪̃ItZbgԂ
+    std::size_t Allocate(const std::size_t size, const std::size_t alignment = BakedModelAlignment)
+    {
+        const auto offset = ( m_data.size() + alignment - 1 ) / alignment * alignment;
+        m_data.resize( offset + size );
+        return offset;
+    }
+
+    template <class T>
+    void Write(const std::size_t offset, const T& value)
+    {
+        std::memcpy( &m_data[offset], &value, sizeof( T ) );
+    }
+
+    void Write(const std::size_t offset, const void* data, const std::size_t size)
+    {
+        if ( size != 0 )
+            std::memcpy( &m_data[offset], data, size );
+    }
+
+    //arrayOffsetɂBakedArraydataOffsetcount̗vfw悤ɂ
+    void Link(const std::size_t arrayOffset, const std::size_t dataOffset, const std::size_t count)
+    {
+        BakedArray<char> array{};
+        if ( count != 0 )
+            array.offset = static_cast<int64_t>( dataOffset ) - static_cast<int64_t>( arrayOffset );
+        array.count = count;
+        Write( arrayOffset, array );
+    }
+
+    //݁AarrayOffsetBakedStringQƂ
+    void WriteString(const std::size_t arrayOffset, const std::string_view str)
+    {
+        const auto offset = Allocate( str.size() + 1, 1 );
+        Write( offset, str.data(), str.size() );
+        Link( arrayOffset, offset, str.size() );
+    }
+
+    //𑵂ăwb_[ɃTCY
+    const std::vector<char>& Finish()
+    {
+        Allocate( 0 );
+        Write( offsetof( BakedModelHeader, size ), static_cast<uint64_t>( m_data.size() ) );
+        return m_data;
+    }
+
+private:
+    std::vector<char> m_data;
+};
+
+//.umb/.usb(`)xCNς݃C[W
+//_̌^ɈˑȂ悤_tH[}bgTCY߂ăoCĝ܂܈ڂ
+inline bool BakeModelBinary(const std::string& srcFilename, const std::string& dstFilename, const bool skinned)
+{
+    MappedFileStream file;
+    if ( !file.Load( srcFilename.c_str() ) || IsContainerData( file.GetData(), file.GetSize() ) )
+        return false;
+    MemoryStream stream( file.GetData(), file.GetSize() );
+
+    struct Node
+    {
+        std::string name;
+        int32_t parent;
+        Float3 position;
+        Float4 rotation;
+        Float3 scale;
+    };
+    struct Bone
+    {
+        Matrix bindPose;
+        int32_t transform;
+    };
+    struct Mesh
+    {
+        const char* vertexDatas;
+        uint32_t vertexCount;
+        const char* indexes;
+        uint32_t indexCount;
+        std::vector<Bone> bones;
+        int32_t materialNo;
+    };
+    struct Material
+    {
+        std::string name;
+        std::vector<std::pair<std::string, Float4>> colors;
+        std::vector<std::pair<std::string, std::string>> textures;
+    };
+
+    //Kw\sɕׂ
+    std::vector<Node> nodes;
+    if ( skinned )
+    {
+        auto active = -1;
+        auto transformCount = 0;
+        do
+        {
+            short tmpCount;
+            stream.Read( &tmpCount, sizeof( short ) );
+            if ( tmpCount == -1 )
+            {
+                transformCount--;
+                active = nodes[active].parent;
+                continue;
+            }
+            transformCount++;
+            Node node;
+            node.name.resize( tmpCount );
+            stream.Read( &node.name[0], tmpCount );
+            node.parent = active;
+            stream.Read( &node.position, sizeof( float ) * 3 );
+            Float3 euler;
+            stream.Read( &euler, sizeof( float ) * 3 );
+            const auto rotation = MakeQuaternion( euler );
+            node.rotation = Float4( rotation.x, rotation.y, rotation.z, rotation.w );
+            stream.Read( &node.scale, sizeof( float ) * 3 );
+            active = static_cast<int>( nodes.size() );
+            nodes.push_back( std::move( node ) );
+            if ( stream.Tell() > stream.GetSize() )
+                return false;
+        }
+        while ( transformCount != 0 );
+    }
+
+    short vertexFormat;
+    stream.Read( &vertexFormat, sizeof( short ) );
+    uint16_t modelCount;
+    stream.Read( &modelCount, sizeof( uint16_t ) );
+    const auto vertexSize = ( skinned ? 32 : 0 ) + GetVertexFormatSize( vertexFormat ); //BoneIndex & BoneWeight
+
+    std::vector<Mesh> meshes( modelCount );
+    std::vector<Material> materials;
+    std::string name;
+    for ( auto& mesh : meshes )
+    {
+        stream.Read( &mesh.vertexCount, sizeof( uint32_t ) );
+        mesh.vertexDatas = stream.Map( static_cast<std::size_t>( vertexSize ) * mesh.vertexCount );
+        stream.Read( &mesh.indexCount, sizeof( uint32_t ) );
+        mesh.indexes = stream.Map( sizeof( uint32_t ) * mesh.indexCount );
+        if ( stream.Tell() > stream.GetSize() )
+            return false;
+
+        //{[Transform::FindƓsōŏɖOv̂w
+        if ( skinned )
+        {
+            uint16_t basePoseCount;
+            stream.Read( &basePoseCount, sizeof( uint16_t ) );
+            mesh.bones.resize( basePoseCount );
+            for ( auto& bone : mesh.bones )
+            {
+                ReadString( stream, name );
+                Matrix tmp;
+                stream.Read( &tmp, sizeof( float ) * 16 );
+                bone.bindPose = Transpose( tmp );
+                const auto node = std::find_if( nodes.begin(), nodes.end(),
+                                                [&name](const Node& n) { return n.name == name; } );
+                bone.transform = node == nodes.end() ? -1 : static_cast<int32_t>( node - nodes.begin() );
+            }
+        }
+
+        //̃}eA͓
+        Material material;
+        ReadString( stream, material.name );
+        uint16_t colorCount;
+        stream.Read( &colorCount, sizeof( uint16_t ) );
+        for ( auto i = 0; i < colorCount; i++ )
+        {
+            auto property = ReadString( stream );
+            Float4 color;
+            stream.Read( &color, sizeof( float ) * 4 );
+            material.colors.emplace_back( std::move( property ), color );
+        }
+        uint16_t textureCount;
+        stream.Read( &textureCount, sizeof( uint16_t ) );
+        for ( auto i = 0; i < textureCount; i++ )
+        {
+            auto property = ReadString( stream );
+            auto textureName = ReadString( stream );
+            material.textures.emplace_back( std::move( property ), std::move( textureName ) );
+        }
+        if ( stream.Tell() > stream.GetSize() )
+            return false;
+        const auto itr = std::find_if( materials.begin(), materials.end(),
+                                       [&material](const Material& m) { return m.name == material.name; } );
+        mesh.materialNo = static_cast<int32_t>( itr - materials.begin() );
+        if ( itr == materials.end() )
+            materials.push_back( std::move( material ) );
+    }
+
+    //wb_[ƌŒ蒷̔zɊmۂAϒ̃f[^ɕׂ
+    BakedImageWriter writer;
+    const auto header = writer.Allocate( sizeof( BakedModelHeader ) );
+    const auto transformArray = writer.Allocate( sizeof( BakedTransform ) * nodes.size() );
+    const auto meshArray = writer.Allocate( sizeof( BakedMesh ) * meshes.size() );
+    const auto materialArray = writer.Allocate( sizeof( BakedMaterial ) * materials.size() );
+    writer.Write( header + offsetof( BakedModelHeader, magic ), BakedModelMagic );
+    writer.Write( header + offsetof( BakedModelHeader, version ), BakedModelVersion );
+    writer.Write( header + offsetof( BakedModelHeader, vertexFormat ), static_cast<int32_t>( vertexFormat ) );
+    writer.Write( header + offsetof( BakedModelHeader, vertexSize ), static_cast<uint32_t>( vertexSize ) );
+    writer.Write( header + offsetof( BakedModelHeader, skinned ), static_cast<uint32_t>( skinned ) );
+    writer.Link( header + offsetof( BakedModelHeader, transforms ), transformArray, nodes.size() );
+    writer.Link( header + offsetof( BakedModelHeader, meshes ), meshArray, meshes.size() );
+    writer.Link( header + offsetof( BakedModelHeader, materials ), materialArray, materials.size() );
+
+    for ( std::size_t i = 0; i < nodes.size(); i++ )
+    {
+        const auto& node = nodes[i];
+        const auto offset = transformArray + sizeof( BakedTransform ) * i;
+        writer.Write( offset + offsetof( BakedTransform, parent ), node.parent );
+        writer.Write( offset + offsetof( BakedTransform, rotation ), node.rotation );
+        writer.Write( offset + offsetof( BakedTransform, position ), node.position );
+        writer.Write( offset + offsetof( BakedTransform, scale ), node.scale );
+        writer.WriteString( offset + offsetof( BakedTransform, name ), node.name );
+    }
+
+    for ( std::size_t i = 0; i < meshes.size(); i++ )
+    {
+        const auto& mesh = meshes[i];
+        const auto offset = meshArray + sizeof( BakedMesh ) * i;
+        const auto vertexBytes = static_cast<std::size_t>( vertexSize ) * mesh.vertexCount;
+        const auto vertexDatas = writer.Allocate( vertexBytes );
+        writer.Write( vertexDatas, mesh.vertexDatas, vertexBytes );
+        IndexArray indexArray;
+        indexArray.Assign( mesh.indexes, mesh.indexCount, mesh.vertexCount );
+        const auto indexBytes = indexArray.GetStride() * mesh.indexCount;
+        const auto indexes = writer.Allocate( indexBytes );
+        writer.Write( indexes, indexArray.data(), indexBytes );
+        const auto bones = writer.Allocate( sizeof( BakedBone ) * mesh.bones.size() );
+        for ( std::size_t j = 0; j < mesh.bones.size(); j++ )
+        {
+            const auto bone = bones + sizeof( BakedBone ) * j;
+            writer.Write( bone + offsetof( BakedBone, bindPose ), &mesh.bones[j].bindPose, sizeof( float ) * 16 );
+            writer.Write( bone + offsetof( BakedBone, transform ), mesh.bones[j].transform );
+        }
+        writer.Link( offset + offsetof( BakedMesh, vertexDatas ), vertexDatas, vertexBytes );
+        if ( indexArray.IsShort() )
+            writer.Link( offset + offsetof( BakedMesh, shortIndexes ), indexes, mesh.indexCount );
+        else
+            writer.Link( offset + offsetof( BakedMesh, indexes ), indexes, mesh.indexCount );
+        writer.Link( offset + offsetof( BakedMesh, bones ), bones, mesh.bones.size() );
+        writer.Write( offset + offsetof( BakedMesh, vertexCount ), mesh.vertexCount );
+        writer.Write( offset + offsetof( BakedMesh, materialNo ), mesh.materialNo );
+    }
+
+    for ( std::size_t i = 0; i < materials.size(); i++ )
+    {
+        const auto& material = materials[i];
+        const auto offset = materialArray + sizeof( BakedMaterial ) * i;
+        const auto colors = writer.Allocate( sizeof( BakedColor ) * material.colors.size() );
+        const auto textures = writer.Allocate( sizeof( BakedTexture ) * material.textures.size() );
+        writer.WriteString( offset + offsetof( BakedMaterial, name ), material.name );
+        writer.Link( offset + offsetof( BakedMaterial, colors ), colors, material.colors.size() );
+        writer.Link( offset + offsetof( BakedMaterial, textures ), textures, material.textures.size() );
+        for ( std::size_t j = 0; j < material.colors.size(); j++ )
+        {
+            const auto color = colors + sizeof( BakedColor ) * j;
+            writer.Write( color + offsetof( BakedColor, color ), material.colors[j].second );
+            writer.WriteString( color + offsetof( BakedColor, property ), material.colors[j].first );
+        }
+        for ( std::size_t j = 0; j < material.textures.size(); j++ )
+        {
+            const auto texture = textures + sizeof( BakedTexture ) * j;
+            writer.WriteString( texture + offsetof( BakedTexture, property ), material.textures[j].first );
+            writer.WriteString( texture + offsetof( BakedTexture, textureName ), material.textures[j].second );
+        }
+    }
+
+    const auto& image = writer.Finish();
+    FILE* fp;
+    if ( fopen_s( &fp, dstFilename.c_str(), "wb" ) != 0 )
+        return false;
+    const auto written = fwrite( image.data(), 1, image.size(), fp );
+    fclose( fp );
+    return written == image.size();
+}
+
+//xCNς݃C[W𒼐ڎQƂ郂f
+//t@C}bvăwb_[mF邾ŁAbV}eẢ͂|C^̏CsȂ
+template <class X>
+struct BakedModelView
+{
+private:
+    std::unique_ptr<Arena> m_arena = std::make_unique<Arena>();
+    MappedFileStream m_fileStream;
+    const BakedModelHeader* m_header = nullptr;
+    std::string m_directory;
+    std::pmr::vector<ResourcePtr<Transform>> m_transforms{ m_arena.get() };
+
+public:
+    BakedModelView() = default;
+
+    BakedModelView(BakedModelView&& other)
+    {
+        *this = std::move( other );
+    }
+
+    BakedModelView& operator=(BakedModelView&& other)
+    {
+        if ( this != &other )
+        {
+            MoveResourceMember( m_transforms, std::move( other.m_transforms ) );
+            m_fileStream = std::move( other.m_fileStream );
+            m_header = std::exchange( other.m_header, nullptr );
+            m_directory = std::move( other.m_directory );
+            m_arena = std::exchange( other.m_arena, std::make_unique<Arena>() );
+            ResetResourceMember( other.m_transforms, other.m_arena.get() );
+            other.m_directory.clear();
+        }
+        return *this;
+    }
+
+    bool LoadBinary(std::string filename)
+    {
+        if ( !m_fileStream.Load( filename.c_str() ) )
+            return false;
         auto lastSlash = filename.find_last_of( '/' );
         filename.erase( lastSlash );
-        assert( ifs.is_open() );
+        return Attach( m_fileStream.GetData(), m_fileStream.GetSize(), filename );
+    }
+
+    //Ăяoňxɓǂݍ񂾃C[WQƂ
+    //data16byteEɑÃIuWFNg蒷ێ邱
+    bool Attach(const char* data, const std::size_t size, const std::string& directory)
+    {
+        m_header = nullptr;
+        m_transforms.clear();
+        if ( size < sizeof( BakedModelHeader ) || reinterpret_cast<uintptr_t>( data ) % BakedModelAlignment != 0 )
+            return false;
+        const auto* header = reinterpret_cast<const BakedModelHeader*>( data );
+        if ( header->magic != BakedModelMagic || header->version != BakedModelVersion || header->size > size )
+            return false;
+
+        //tH[}bgG[`FbN
+        if ( !CheckVertexFormat<X>( header->vertexFormat, header->skinned ? 32 : 0 ) ) //BoneIndex & BoneWeight
+            return false;
+
+        m_header = header;
+        m_directory = directory;
+        return true;
+    }
+
+    bool IsLoaded() const
+    {
+        return m_header != nullptr;
+    }
+
+    const BakedArray<BakedMesh>& GetMeshes() const
+    {
+        return m_header->meshes;
+    }
+
+    const BakedArray<BakedMaterial>& GetMaterials() const
+    {
+        return m_header->materials;
+    }
+
+    const BakedArray<BakedTransform>& GetTransforms() const
+    {
+        return m_header->transforms;
+    }
+
+    ArrayView<X> GetVertexDatas(const BakedMesh& mesh) const
+    {
+        return ArrayView<X>{ reinterpret_cast<const X*>( mesh.vertexDatas.data() ), mesh.vertexCount };
+    }
+
+    IndexView GetIndexes(const BakedMesh& mesh) const
+    {
+        if ( !mesh.shortIndexes.empty() )
+            return IndexView{ mesh.shortIndexes.data(), mesh.shortIndexes.size(), sizeof( uint16_t ) };
+        return IndexView{ mesh.indexes.data(), mesh.indexes.size(), sizeof( uint32_t ) };
+    }
+
+    //LoadBinaryƓfBNgtpXԂ(OȂ"null")
+    std::string GetTexture(const BakedMaterial& material, const std::string_view property) const
+    {
+        const auto* texture = material.FindTexture( property );
+        if ( texture == nullptr )
+            return std::string();
+        if ( texture->textureName.empty() )
+            return "null";
+        return m_directory + "/" + std::string( texture->textureName.GetStringView() );
+    }
+
+    //Aj[VŎgTransform̊Kw\胋[gԂ
+    //bV̕`悾ȂsvŁÂ͍ŏ̌Ăяöx
+    Transform* CreateHierarchy()
+    {
+        if ( m_transforms.empty() && m_header != nullptr )
+        {
+            m_transforms.reserve( m_header->transforms.size() );
+            for ( const auto& baked : m_header->transforms )
+            {
+                auto transform = MakeResourcePtr<Transform>( m_arena.get() );
+                transform->m_name = baked.name.GetStringView();
+                transform->m_hash = std::hash<std::string_view>()( baked.name.GetStringView() );
+                transform->m_position = baked.position;
+                transform->m_rotation.x = baked.rotation.x;
+                transform->m_rotation.y = baked.rotation.y;
+                transform->m_rotation.z = baked.rotation.z;
+                transform->m_rotation.w = baked.rotation.w;
+                transform->m_scale = baked.scale;
+                if ( baked.parent >= 0 )
+                {
+                    transform->m_parent = m_transforms[baked.parent].get();
+                    transform->m_parent->m_child.push_back( transform.get() );
+                }
+                m_transforms.push_back( std::move( transform ) );
+            }
+        }
+        return m_transforms.empty() ? nullptr : m_transforms[0].get();
+    }
+
+    //CreateHierarchyōTransform̂{[w
+    Transform* GetBoneTransform(const BakedBone& bone) const
+    {
+        if ( bone.transform < 0 || bone.transform >= static_cast<int32_t>( m_transforms.size() ) )
+            return nullptr;
+        return m_transforms[bone.transform].get();
+    }
+};
+
+// {[Transform߂̃e[u
+// XPgƂɈxÃAj[V̓ǂݍ݂ŋL
+class TransformTable
+{
+public:
+    explicit TransformTable(Transform* root)
+    {
+        if ( root != nullptr )
+            Add( root );
+        //(ÕnbV, ԍ)ŕׂĂAȂԍ̏Ɍ
+        std::sort( m_indexes.begin(), m_indexes.end() );
+    }
+
+    //Transform::FindƓ[DōŏɌ̂̔ԍ(-1)
+    int Find(const std::string_view name) const
+    {
+        const auto hash = std::hash<std::string_view>()( name );
+        auto itr = std::lower_bound( m_indexes.begin(), m_indexes.end(), std::make_pair( hash, 0 ) );
+        for ( ; itr != m_indexes.end() && itr->first == hash; ++itr )
+        {
+            if ( std::string_view( m_transforms[itr->second]->m_name ) == name )
+                return itr->second;
+        }
+        return -1;
+    }
+
+    //ԍ͐[D̍s
+    Transform* Get(const int index) const
+    {
+        return m_transforms[index];
+    }
+
+    int GetCount() const
+    {
+        return static_cast<int>( m_transforms.size() );
+    }
+
+private:
+    void Add(Transform* transform)
+    {
+        m_indexes.emplace_back( std::hash<std::string_view>()( transform->m_name ), GetCount() );
+        m_transforms.push_back( transform );
+        for ( auto* child : transform->m_child )
+            Add( child );
+    }
+
+    std::vector<Transform*> m_transforms;
+    std::vector<std::pair<std::size_t, int>> m_indexes;
+};
+
+struct SkinnedAnimation
+{
+private:
+    //L[͑SẴA[imۂASkinnedAnimation̔jɂ܂Ƃ߂ĉ
+    std::unique_ptr<Arena> m_arena = std::make_unique<Arena>();
+
+public:
+    struct Curve
+    {
+        Curve() = default;
+
+        explicit Curve(std::pmr::memory_resource* resource)
+            : times( resource ), keys( resource ), inSlopes( resource ), outSlopes( resource )
+        {
+        }
+
+        std::pmr::vector<float> times;
+        std::pmr::vector<float> keys;
+        //HermiteȐ̃L[ɓXƃL[oX(l/bAȂ`)
+        std::pmr::vector<float> inSlopes;
+        std::pmr::vector<float> outSlopes;
+
+        static float Lerp(const float f1, const float f2, const float t)
+        {
+            return f1 + ( f2 - f1 ) * t;
+        }
+
+        bool IsHermite() const
+        {
+            return !outSlopes.empty();
+        }
+
+        //SĂ̎ԂœlɂȂ邩
+        bool IsConstant() const
+        {
+            auto zero = [](const float slope) { return slope == 0; };
+            return std::adjacent_find( keys.begin(), keys.end(), std::not_equal_to<>() ) == keys.end() &&
+                std::all_of( inSlopes.begin(), inSlopes.end(), zero ) && std::all_of( outSlopes.begin(), outSlopes.end(), zero );
+        }
+
+        float GetValue(const float time) const
+        {
+            auto key = 0U;
+            return GetValue( time, key );
+        }
+
+        //key͑OԂԂ̐擪̃L[(Ԃꍇ͍̋ԂɍXV)
+        float GetValue(const float time, uint32_t& key) const
+        {
+            if ( times.size() == 1 )
+                return keys[0];
+            if ( time < times[0] )
+                return keys[0];
+            if ( time > times[times.size() - 1] )
+                return keys[keys.size() - 1];
+
+            key = FindKey( times.data(), times.size(), time, key );
+            const auto s = ( time - times[key] ) / ( times[key + 1] - times[key] );
+            if ( !IsHermite() )
+                return Lerp( keys[key], keys[key + 1], s );
+            return Evaluate( GetHermiteBasis( s, times[key + 1] - times[key] ), key );
+        }
+
+        //timeł̒lƁA̎ԂɓXEoX(L[̎Ԃł͑ŐԂ̌XA͈͊O0)
+        void GetValueAndSlopes(const float time, uint32_t& key, float& value, float& inSlope, float& outSlope) const
+        {
+            value = GetValue( time, key );
+            inSlope = 0;
+            outSlope = 0;
+            const auto count = times.size();
+            if ( count == 1 || time < times[0] || time > times[count - 1] )
+                return;
+            if ( time == times[count - 1] )
+            {
+                inSlope = GetSlope( static_cast<uint32_t>( count - 2 ), 1 );
+                return;
+            }
+            key = FindKey( times.data(), count, time, key );
+            const auto s = ( time - times[key] ) / ( times[key + 1] - times[key] );
+            outSlope = GetSlope( key, s );
+            inSlope = s == 0 ? ( key > 0 ? GetSlope( key - 1, 1 ) : 0.0f ) : outSlope;
+        }
+
+        //keybasišWŋ߂(HermiteȐ̂)
+        float Evaluate(const HermiteBasis& basis, const uint32_t key) const
+        {
+            return basis.Evaluate( keys[key], outSlopes[key], keys[key + 1], inSlopes[key + 1] );
+        }
+
+        //keÿʒusł̌X
+        float GetSlope(const uint32_t key, const float s) const
+        {
+            const auto dt = times[key + 1] - times[key];
+            if ( !IsHermite() )
+                return ( keys[key + 1] - keys[key] ) / dt;
+            return Evaluate( GetHermiteSlopeBasis( s, dt ), key );
+        }
+
+        //times[i] <= time < times[i + 1]ƂȂi(Ō̋ԂtimẽL[Ɠꍇ܂ށAcount2ȏ)
+        //ŐԂ̎̋ԂɎ܂Ă΂̂܂܎gAV[Nꍇ͓񕪒T
+        static uint32_t FindKey(const float* times, const std::size_t count, const float time, const uint32_t key)
+        {
+            const auto last = static_cast<uint32_t>( count - 2 );
+            if ( key <= last && times[key] <= time )
+            {
+                if ( key == last || time < times[key + 1] )
+                    return key;
+                if ( key + 1 == last || time < times[key + 2] )
+                    return key + 1;
+            }
+            return SearchKey( times, count, time );
+        }
+
+        //񕪒TFindKeyƓԂ߂
+        static uint32_t SearchKey(const float* times, const std::size_t count, const float time)
+        {
+            const auto itr = std::upper_bound( times + 1, times + count - 1, time );
+            return static_cast<uint32_t>( itr - times ) - 1;
+        }
+    };
+
+    //]̃J[u(xyzw𓯂Ԃ̃L[ɂ܂Ƃ߁A1̌ŋ߂Ԃnlerp)
+    //vf̃J[uHermiteȐȂAvfƂHermiteԂ̌ʂ𐳋K
+    struct RotationCurve
+    {
+        RotationCurve() = default;
+
+        explicit RotationCurve(std::pmr::memory_resource* resource)
+            : times( resource ), keys( resource ), inSlopes( resource ), outSlopes( resource )
+        {
+        }
+
+        std::pmr::vector<float> times;
+        std::pmr::vector<float> keys; //L[Ƃxyzw
+        std::pmr::vector<float> inSlopes; //HermiteȐ̏ꍇ̃L[Ƃxyzw̌X(Ȃ`)
+        std::pmr::vector<float> outSlopes;
+
+        //vfƂ̃J[u(x, y, z, w)̃L[̎Ԃ킹č
+        //ÕL[ƓɂȂ悤𑵂̂ŕԂ͏ɍŒZoHɂȂ(`Ԃ̃L[͐KĂ)
+        void Build(const Curve* curves)
+        {
+            times.clear();
+            keys.clear();
+            inSlopes.clear();
+            outSlopes.clear();
+            for ( auto i = 0; i < 4; i++ )
+                times.insert( times.end(), curves[i].times.begin(), curves[i].times.end() );
+            std::sort( times.begin(), times.end() );
+            times.erase( std::unique( times.begin(), times.end() ), times.end() );
+            if ( times.empty() )
+                times.push_back( 0 );
+            const auto hermite = std::any_of( curves, curves + 4, [](const Curve& curve) { return curve.IsHermite(); } );
+            uint32_t cursor[4]{};
+            for ( std::size_t k = 0; k < times.size(); k++ )
+            {
+                static constexpr float Identity[4] = { 0, 0, 0, 1 };
+                float value[4], in[4]{}, out[4]{};
+                for ( auto i = 0; i < 4; i++ )
+                {
+                    if ( curves[i].times.empty() )
+                        value[i] = Identity[i];
+                    else
+                        curves[i].GetValueAndSlopes( times[k], cursor[i], value[i], in[i], out[i] );
+                }
+                if ( !hermite )
+                    NormalizeQuaternion( value );
+                if ( k > 0 )
+                {
+                    const auto* previous = &keys[keys.size() - 4];
+                    const auto dot = previous[0] * value[0] + previous[1] * value[1] + previous[2] * value[2] +
+                        previous[3] * value[3];
+                    if ( dot < 0 )
+                    {
+                        for ( auto i = 0; i < 4; i++ )
+                        {
+                            value[i] = -value[i];
+                            in[i] = -in[i];
+                            out[i] = -out[i];
+                        }
+                    }
+                }
+                keys.insert( keys.end(), value, value + 4 );
+                if ( hermite )
+                {
+                    inSlopes.insert( inSlopes.end(), in, in + 4 );
+                    outSlopes.insert( outSlopes.end(), out, out + 4 );
+                }
+            }
+            //SēȂ萔ɂ
+            auto zero = [](const float slope) { return slope == 0; };
+            if ( std::equal( keys.begin() + 4, keys.end(), keys.begin() ) &&
+                std::all_of( inSlopes.begin(), inSlopes.end(), zero ) && std::all_of( outSlopes.begin(), outSlopes.end(), zero ) )
+            {
+                times.resize( 1 );
+                keys.resize( 4 );
+                inSlopes.clear();
+                outSlopes.clear();
+                NormalizeQuaternion( keys.data() );
+            }
+        }
+
+        //keyCurve::GetValueƓOԂԂ̐擪̃L[
+        //normalizefalseȂ`Ԃl𐳋KɕԂ(SoA̍sɎgAHermiteȐ͏ɐK)
+        void GetValue(const float time, uint32_t& key, float (&value)[4], const bool normalize = true) const
+        {
+            const auto count = times.size();
+            const auto* last = &keys[( count - 1 ) * 4];
+            if ( count == 1 || time < times[0] || time > times[count - 1] )
+            {
+                std::copy_n( count == 1 || time < times[0] ? keys.data() : last, 4, value );
+                if ( !inSlopes.empty() )
+                    NormalizeQuaternion( value );
+                return;
+            }
+            key = Curve::FindKey( times.data(), count, time, key );
+            const auto s = ( time - times[key] ) / ( times[key + 1] - times[key] );
+            const auto* from = &keys[key * 4];
+            if ( inSlopes.empty() && normalize )
+            {
+                NlerpQuaternion( from, from + 4, s, value );
+                return;
+            }
+            if ( inSlopes.empty() )
+            {
+                for ( auto i = 0; i < 4; i++ )
+                    value[i] = Curve::Lerp( from[i], from[i + 4], s );
+                return;
+            }
+            const auto basis = GetHermiteBasis( s, times[key + 1] - times[key] );
+            const auto* out = &outSlopes[key * 4];
+            const auto* in = &inSlopes[key * 4 + 4];
+            for ( auto i = 0; i < 4; i++ )
+                value[i] = basis.Evaluate( from[i], out[i], from[i + 4], in[i] );
+            NormalizeQuaternion( value );
+        }
+    };
+
+    struct Animation
+    {
+        Animation() = default;
+
+        explicit Animation(std::pmr::memory_resource* resource)
+            : curves{
+                Curve( resource ), Curve( resource ), Curve( resource ), Curve( resource ), Curve( resource ),
+                Curve( resource ), Curve( resource ), Curve( resource ), Curve( resource ), Curve( resource )
+            }, rotationCurve( resource )
+        {
+        }
+
+        Transform* transform = nullptr;
+        Curve curves[10];
+        RotationCurve rotationCurve; //curves[3..6]܂Ƃ߂(ǂݍݎɍ)
+
+        void SetTransform(const float time)
+        {
+            uint32_t keys[10]{};
+            SetTransform( time, keys );
+        }
+
+        //keys̓J[uƂ̑Ő(Curve::GetValueQƁA]keys[3]g)
+        void SetTransform(const float time, uint32_t* keys)
+        {
+            if (!transform)
+                return;
+            const Float3 position = {
+                curves[0].GetValue( time, keys[0] ), curves[1].GetValue( time, keys[1] ),
+                curves[2].GetValue( time, keys[2] )
+            };
+            float value[4];
+            rotationCurve.GetValue( time, keys[3], value );
+            const Vector4 rotation = { { value[0], value[1], value[2], value[3] } };
+            const Float3 scale = {
+                curves[7].GetValue( time, keys[7] ), curves[8].GetValue( time, keys[8] ),
+                curves[9].GetValue( time, keys[9] )
+            };
+
+            transform->m_position = position;
+            transform->m_rotation = rotation;
+            transform->m_scale = scale;
+        }
+    };
+
+    // RpNg`̃gbN(clipDatäʒuƃL[AL[1Ȃ萔)
+    struct ClipTrack
+    {
+        uint32_t offset;
+        uint32_t keyCount;
+    };
+
+    // RpNg`̃{[1{(ʒuE]EXP[̃gbN)
+    struct ClipBone
+    {
+        Transform* transform = nullptr;
+        ClipTrack tracks[ClipTrackCount]{};
+    };
+
+    //p̐̐(ʒuxyzE]xyzwEXP[xyzAAnimation::curvesƓ)
+    static constexpr int PoseChannelCount = 10;
+
+    //SoA̎p(ƂɃ{[̐lAĕׂ)
+    //{[̕тGetPoseTransformƓ
+    struct Pose
+    {
+        std::vector<float> channels;
+        std::size_t boneCount = 0;
+
+        void Resize(const std::size_t count)
+        {
+            boneCount = count;
+            channels.resize( count * PoseChannelCount );
+        }
+
+        float* GetChannel(const int channel)
+        {
+            return channels.data() + boneCount * channel;
+        }
+
+        const float* GetChannel(const int channel) const
+        {
+            return channels.data() + boneCount * channel;
+        }
+    };
 
-        LoadHierarchyAscii( ifs );
+    //ĐʒuƂ̃L[̌ʒu(gbNƂɑOԂԂoĂ)
+    //قڒPɐiލĐł̓L[̌O(1)ɂȂAV[Nꍇ͓񕪒TɂȂ
+    //Aj[V𕡐̃LN^[ŕʁX̎ԂɍĐꍇ̓LN^[ƂɎ
+    struct Cursor
+    {
+        std::vector<uint32_t> keys;
+        uint32_t sampleKey = 0; //SoAɂ܂Ƃ߂ꍇ̋ʂ̃^CC̋
+        Pose pose; //SetTransformŃTvOp
+    };
 
-        //_tH[}bgǂݍ
-        int vertexFormat;
-        ifs >> vertexFormat;
+private:
+    std::vector<Animation> animationList;
+    float maxAnimationTime = 0;
+    //RpNg`̃Nbvǂݍ񂾏ꍇanimationList̑ɂg
+    std::vector<ClipBone> clipBoneList;
+    std::pmr::vector<char> clipData{ m_arena.get() }; //SẴgbÑf[^
+    float clipSampleRate = 0;
+    Cursor cursor; //SetTransform(time)p
 
-        int modelCount;
-        ifs >> modelCount;
+    //Ƃ̔ẑAԂ邩萔{[͈
+    struct PoseSpan
+    {
+        uint32_t offset; //Pose::channels̈ʒu
+        uint32_t count;
+        uint32_t source; //Ԃ͈͂samplerKeys̍s̈ʒuA萔͈̔͂samplerConstants̈ʒu
+        bool animated;
+    };
 
-        //tH[}bgG[`FbN
-        std::vector<bool> formatFlg;
-        formatFlg.resize( 12 );
-        auto totalByte = 32; //BoneIndex & BoneWeight
-        for ( auto i = 0; i < VertexFormatSizes.size(); i++ )
-            if ( vertexFormat & static_cast<int>(VertexFormatSizes[i].first) )
-                totalByte += VertexFormatSizes[i].second;
-        if ( totalByte != sizeof( X ) )
+    //ǂݍݎɑSẴgbNSoAɂ܂Ƃ߂(poseSpansȂ܂Ƃ߂ĂȂ)
+    //L[̎ԂSẴgbNō킹ʂ̃^CCAsƂɕԂlAĕׂ
+    //ǂ̒lԁE䗦ŕԂ̂ŁA1̃L[̌SIMD̐`ԂŎp߂
+    std::vector<Transform*> poseTransforms; //p̃{[̕(animationList, clipBoneList̏)
+    std::vector<PoseSpan> poseSpans;
+    std::pmr::vector<float> samplerTimes{ m_arena.get() };
+    std::pmr::vector<float> samplerKeys{ m_arena.get() }; //(samplerTimes.size() + 1)s x GetSamplerRowStride()(Ō̍s͖̕)
+    std::pmr::vector<float> samplerConstants{ m_arena.get() };
+    std::size_t samplerRowSize = 0;
+    bool samplerCubic = false; //HermiteȐȂs[l | L[oX | L[ɓX]
+public:
+    SkinnedAnimation() = default;
+
+    SkinnedAnimation(SkinnedAnimation&& other)
+    {
+        *this = std::move( other );
+    }
+
+    SkinnedAnimation& operator=(SkinnedAnimation&& other)
+    {
+        if ( this != &other )
         {
-            auto errorLog = std::string( typeid( X ).name() ) + " is " + std::to_string( sizeof( X ) ) + "\n " +
-                "The required size is " + std::to_string( totalByte ) + " bytes";
-            std::cout << errorLog;
-            return;
+            animationList = std::move( other.animationList );
+            maxAnimationTime = std::exchange( other.maxAnimationTime, 0.0f );
+            clipBoneList = std::move( other.clipBoneList );
+            MoveResourceMember( clipData, std::move( other.clipData ) );
+            clipSampleRate = std::exchange( other.clipSampleRate, 0.0f );
+            cursor = std::exchange( other.cursor, Cursor{} );
+            poseTransforms = std::move( other.poseTransforms );
+            poseSpans = std::move( other.poseSpans );
+            MoveResourceMember( samplerTimes, std::move( other.samplerTimes ) );
+            MoveResourceMember( samplerKeys, std::move( other.samplerKeys ) );
+            MoveResourceMember( samplerConstants, std::move( other.samplerConstants ) );
+            samplerRowSize = std::exchange( other.samplerRowSize, 0 );
+            samplerCubic = std::exchange( other.samplerCubic, false );
+            m_arena = std::exchange( other.m_arena, std::make_unique<Arena>() );
+            ResetResourceMember( other.clipData, other.m_arena.get() );
+            ResetResourceMember( other.samplerTimes, other.m_arena.get() );
+            ResetResourceMember( other.samplerKeys, other.m_arena.get() );
+            ResetResourceMember( other.samplerConstants, other.m_arena.get() );
         }
+        return *this;
+    }
 
-        for ( auto i = 0; i < modelCount; i++ )
+    void LoadAscii(std::string filename, Transform* root)
+    {
+        MappedFileStream file( filename.c_str() );
+        assert( file.IsOpen() );
+        AsciiTokenizer tokenizer( file.GetData(), file.GetSize() );
+
+        const TransformTable table( root );
+        std::vector<bool> animated( table.GetCount() );
+        const auto animationCount = tokenizer.Read<int>();
+        ResetAnimationList( animationCount, table );
+        for ( auto i = 0; i < animationCount; i++ )
         {
-            Mesh model;
-            //_ǂݍ
-            int vertexCount;
-            ifs >> vertexCount;
-            for ( auto j = 0; j < vertexCount; j++ )
+            auto& anim = animationList[i];
+            anim.transform = Resolve( table, tokenizer.ReadStringView(), animated );
+            for ( auto& curve : anim.curves )
             {
-                uint8_t* rawData = new uint8_t[sizeof( X )];
-                auto rawCnt = 0;
+                const auto keyCount = tokenizer.Read<int>();
+                curve.times.resize( keyCount );
+                curve.keys.resize( keyCount );
+                tokenizer.Read( curve.times.data(), keyCount );
+                for ( auto k = 0; k < keyCount; k++ )
+                {
+                    if ( curve.times[k] > maxAnimationTime )
+                        maxAnimationTime = curve.times[k];
+                }
+                tokenizer.Read( curve.keys.data(), keyCount );
+            }
+            anim.rotationCurve.Build( &anim.curves[3] );
+        }
+        CheckTransform( table, animated );
+        BuildSampler();
+    }
+
+    void LoadBinary(const std::string& filename, Transform* root)
+    {
+        FileStream fileStream( filename.c_str() );
+        LoadBinaryStream( fileStream, root );
+    }
+
+    //I/Oobt@bufferTCYɗ}ēǂݍ
+    //t@CJȂrŐ؂ĂꍇfalseԂ(ǂݍ񂾓e͎gȂ)
+    bool LoadBinary(const std::string& filename, Transform* root, const std::size_t bufferSize)
+    {
+        StreamingFileStream fileStream( filename.c_str(), bufferSize );
+        if ( !fileStream.IsOpen() )
+            return false;
+        LoadBinaryStream( fileStream, root );
+        return !fileStream.IsFailed();
+    }
+
+    //Read(void*, int)Cӂ̃Xg[ǂݍ
+    template <class Stream>
+    void LoadBinaryStream(Stream& fileStream, Transform* root)
+    {
+        LoadBinaryStream( fileStream, TransformTable( root ) );
+    }
 
-                for ( auto i1 = 0; i1 < VertexFormatSizes.size(); i1++ )
+    //쐬ς݂̃{[̕\gēǂݍ
+    //`ƃRei`̂ǂǂݍ߂
+    template <class Stream>
+    void LoadBinaryStream(Stream& stream, const TransformTable& table)
+    {
+        ContainerStream<Stream> fileStream( stream );
+        std::vector<bool> animated( table.GetCount() );
+        std::string transformName;
+        if ( fileStream.IsContainer() )
+        {
+            std::vector<ContainerSection> sections;
+            if ( !ReadContainerHeader( fileStream, ContainerKind::Animation, sections ) )
+                return;
+            for ( const auto& entry : sections )
+            {
+                ContainerSection section;
+                if ( !fileStream.BeginSection( entry, section ) )
+                    return;
+                const auto type = static_cast<ContainerSectionType>( section.type );
+                if ( type == ContainerSectionType::AnimationInfo )
                 {
-                    if ( vertexFormat & static_cast<int>(VertexFormatSizes[i1].first) )
-                    {
-                        float tmpData[4];
-                        auto dataSize = VertexFormatSizes[i1].second / 4;
-                        for ( auto i2 = 0; i2 < dataSize; i2++ )
-                            ifs >> tmpData[i2];
-                        memcpy( &rawData[rawCnt], tmpData, VertexFormatSizes[i1].second );
-                        rawCnt += VertexFormatSizes[i1].second;
-                    }
+                    uint32_t animationCount;
+                    fileStream.Read( &animationCount, sizeof( uint32_t ) );
+                    ResetAnimationList( animationCount, table );
+                }
+                else if ( ( type == ContainerSectionType::Animation || type == ContainerSectionType::HermiteAnimation ) &&
+                    section.index < animationList.size() )
+                {
+                    LoadAnimationBinary( fileStream, animationList[section.index], table, animated, transformName,
+                                         type == ContainerSectionType::HermiteAnimation );
                 }
-                Int4 boneIndex;
-                Float4 boneWeight;
-                ifs >> boneIndex.x >> boneIndex.y >> boneIndex.z >> boneIndex.w;
-                ifs >> boneWeight.x >> boneWeight.y >> boneWeight.z >> boneWeight.w;
-                memcpy( &rawData[rawCnt], &boneIndex, 16 );
-                memcpy( &rawData[rawCnt + 16], &boneWeight, 16 );
+                else if ( type == ContainerSectionType::ClipInfo )
+                {
+                    ClipInfo info;
+                    fileStream.Read( &info, sizeof( ClipInfo ) );
+                    if ( !( info.sampleRate > 0 ) )
+                        return;
+                    ResetClip( info, table );
+                }
+                else if ( type == ContainerSectionType::ClipBone && section.index < clipBoneList.size() )
+                {
+                    if ( !LoadClipBone( fileStream, clipBoneList[section.index], table, animated, transformName ) )
+                        return;
+                }
+            }
+            CheckTransform( table, animated );
+            BuildSampler();
+            return;
+        }
+
+        uint32_t animationCount;
+        fileStream.Read( &animationCount, sizeof( uint32_t ) );
+
+        ResetAnimationList( animationCount, table );
+        for ( uint32_t i = 0; i < animationCount; i++ )
+            LoadAnimationBinary( fileStream, animationList[i], table, animated, transformName );
+        CheckTransform( table, animated );
+        BuildSampler();
+    }
+
+    //XPgɑ΂镡̃Aj[V܂Ƃ߂ēǂݍ
+    //{[̕\͈xAt@CƂ̓ǂݍ݂̓Xbhv[ŕɍs
+    static std::vector<SkinnedAnimation> LoadBinaryLibrary(const std::vector<std::string>& filenames, Transform* root,
+                                                           ThreadPool& threadPool = ThreadPool::GetDefault())
+    {
+        const TransformTable table( root );
+        std::vector<SkinnedAnimation> animations( filenames.size() );
+        threadPool.ParallelFor( filenames.size(), [&](const std::size_t i)
+        {
+            MappedFileStream file;
+            if ( !file.Load( filenames[i].c_str() ) )
+                return;
+            MemoryStream fileStream( file.GetData(), file.GetSize() );
+            animations[i].LoadBinaryStream( fileStream, table );
+        } );
+        return animations;
+    }
+
+    void SetTransform(const float time)
+    {
+        SetTransform( time, cursor );
+    };
+
+    void SetTransform(const float time, Cursor& playback)
+    {
+        if ( HasPoseSampler() )
+        {
+            Sample( time, playback, playback.pose );
+            ApplyPose( playback.pose );
+            return;
+        }
+        auto* keys = GetCursorKeys( playback );
+        for ( auto& animation : animationList )
+        {
+            animation.SetTransform( time, keys );
+            keys += 10;
+        }
+        for ( const auto& bone : clipBoneList )
+        {
+            SetClipTransform( bone, time * clipSampleRate, keys );
+            keys += ClipTrackCount;
+        }
+    }
 
-                X data;
-                memcpy( &data, rawData, sizeof( X ) );
-                delete[] rawData;
-                model.vertexDatas.push_back( data );
+    //timeł̎pposeɏ(Transform͕ύXȂ)
+    //SoAɂ܂Ƃ߂ĂȂꍇ̓gbNƂɕԂ
+    void Sample(const float time, Cursor& playback, Pose& pose) const
+    {
+        pose.Resize( poseTransforms.size() );
+        if ( HasPoseSampler() )
+        {
+            SamplePose( time, playback, pose );
+            return;
+        }
+        auto* keys = GetCursorKeys( playback );
+        for ( std::size_t bone = 0; bone < animationList.size(); bone++ )
+        {
+            const auto& animation = animationList[bone];
+            float rotation[4];
+            animation.rotationCurve.GetValue( time, keys[3], rotation );
+            for ( auto channel = 0; channel < PoseChannelCount; channel++ )
+            {
+                pose.GetChannel( channel )[bone] = IsRotationChannel( channel ) ? rotation[channel - 3]
+                                                                                : animation.curves[channel].GetValue( time, keys[channel] );
+            }
+            keys += 10;
+        }
+        for ( std::size_t i = 0; i < clipBoneList.size(); i++ )
+        {
+            const auto bone = animationList.size() + i;
+            for ( auto track = 0; track < ClipTrackCount; track++ )
+            {
+                float value[4];
+                SampleClipTrack( clipBoneList[i].tracks[track], track, time * clipSampleRate, value, keys[track] );
+                for ( auto channel = ClipTrackFirstCurves[track]; channel < ClipTrackFirstCurves[track + 1]; channel++ )
+                    pose.GetChannel( channel )[bone] = value[channel - ClipTrackFirstCurves[track]];
             }
+            keys += ClipTrackCount;
+        }
+    }
 
-            //CfbNXǂݍ
-            int indexCount;
-            ifs >> indexCount;
-            model.indexes.resize( indexCount );
-            for ( auto j = 0; j < indexCount; j++ )
+    //pose{[Transformɏ
+    void ApplyPose(const Pose& pose) const
+    {
+        const auto count = std::min<std::size_t>( pose.boneCount, poseTransforms.size() );
+        for ( std::size_t bone = 0; bone < count; bone++ )
+        {
+            auto* transform = poseTransforms[bone];
+            if ( !transform )
+                continue;
+            const auto* value = pose.channels.data() + bone;
+            const auto stride = pose.boneCount;
+            const Float3 position = { value[0], value[stride], value[stride * 2] };
+            const Vector4 rotation = { { value[stride * 3], value[stride * 4], value[stride * 5], value[stride * 6] } };
+            const Float3 scale = { value[stride * 7], value[stride * 8], value[stride * 9] };
+
+            transform->m_position = position;
+            transform->m_rotation = rotation;
+            transform->m_scale = scale;
+        }
+    }
+
+    //PoseboneԖڂ̒lTransform({[Ȃꍇnullptr)
+    Transform* GetPoseTransform(const std::size_t bone) const
+    {
+        return poseTransforms[bone];
+    }
+
+    std::size_t GetPoseBoneCount() const
+    {
+        return poseTransforms.size();
+    }
+
+    //ǂݍݎSoAɂ܂Ƃ߂(L[̎ԂgbNƂɂ΂΂ł܂Ƃ߂Ƒ傫Ȃ肷ꍇ͂܂Ƃ߂Ȃ)
+    bool HasPoseSampler() const
+    {
+        return !poseSpans.empty();
+    }
+
+    float GetMaxAnimationTime() const
+    {
+        return maxAnimationTime;
+    }
+
+private:
+    //ʂ̃^CC̃L[̐̃L[̐̂̔{𒴂ꍇSoAɂ܂Ƃ߂Ȃ
+    static constexpr std::size_t SamplerMaxKeyRatio = 16;
+
+    //ǂݍݒꍇ͐擪T
+    uint32_t* GetCursorKeys(Cursor& playback) const
+    {
+        const auto trackCount = animationList.size() * 10 + clipBoneList.size() * ClipTrackCount;
+        if ( playback.keys.size() != trackCount )
+            playback.keys.assign( trackCount, 0 );
+        return playback.keys.data();
+    }
+
+    void SamplePose(const float time, Cursor& playback, Pose& pose) const
+    {
+        //͈͊O͐擪̍ŝ܂܎g(̍šɂ͓l̍s)
+        auto key = 0U;
+        auto t = 0.0f;
+        const auto timeCount = samplerTimes.size();
+        if ( timeCount > 1 && time >= samplerTimes[timeCount - 1] )
+        {
+            key = static_cast<uint32_t>( timeCount - 1 );
+        }
+        else if ( timeCount > 1 && time > samplerTimes[0] )
+        {
+            key = Curve::FindKey( samplerTimes.data(), timeCount, time, playback.sampleKey );
+            t = ( time - samplerTimes[key] ) / ( samplerTimes[key + 1] - samplerTimes[key] );
+        }
+        playback.sampleKey = key;
+        const auto* from = samplerKeys.data() + GetSamplerRowStride() * key;
+        const auto* to = from + GetSamplerRowStride();
+        //HermiteȐ̌W͑SĂ̒lœȂ̂ňx߂(͈͊Ot = 0Ő擪̍s̒lɂȂ)
+        const auto basis = GetHermiteBasis( t, t > 0 ? samplerTimes[key + 1] - samplerTimes[key] : 0.0f );
+        auto* dst = pose.channels.data();
+        for ( const auto& span : poseSpans )
+        {
+            if ( span.animated && samplerCubic )
             {
-                ifs >> model.indexes[j];
+                HermiteKeys( from + span.source, from + samplerRowSize + span.source, to + span.source,
+                             to + samplerRowSize * 2 + span.source, basis, dst + span.offset, span.count );
             }
+            else if ( span.animated )
+                LerpKeys( from + span.source, to + span.source, t, dst + span.offset, span.count );
+            else
+                std::memcpy( dst + span.offset, &samplerConstants[span.source], sizeof( float ) * span.count );
+        }
+        NormalizeQuaternions( pose.GetChannel( 3 ), pose.GetChannel( 4 ), pose.GetChannel( 5 ), pose.GetChannel( 6 ),
+                              pose.boneCount );
+    }
 
-            //x[X|[Yǂݍ
-            int basePoseCount;
-            ifs >> basePoseCount;
-            for ( auto j = 0; j < basePoseCount; j++ )
+    static bool IsRotationChannel(const int channel)
+    {
+        return channel >= 3 && channel < 7;
+    }
+
+    //dst[i] = from[i] + (to[i] - from[i]) * t(Curve::LerpƓ)
+    static void LerpKeys(const float* from, const float* to, const float t, float* dst, const std::size_t count)
+    {
+        std::size_t i = 0;
+#ifdef UEM_AVX
+        const auto t8 = _mm256_set1_ps( t );
+        for ( ; i + 8 <= count; i += 8 )
+        {
+            const auto a = _mm256_loadu_ps( from + i );
+            const auto b = _mm256_loadu_ps( to + i );
+            _mm256_storeu_ps( dst + i, _mm256_add_ps( a, _mm256_mul_ps( _mm256_sub_ps( b, a ), t8 ) ) );
+        }
+#endif
+#ifdef UEM_SSE2
+        const auto t4 = _mm_set1_ps( t );
+        for ( ; i + 4 <= count; i += 4 )
+        {
+            const auto a = _mm_loadu_ps( from + i );
+            const auto b = _mm_loadu_ps( to + i );
+            _mm_storeu_ps( dst + i, _mm_add_ps( a, _mm_mul_ps( _mm_sub_ps( b, a ), t4 ) ) );
+        }
+#endif
+        for ( ; i < count; i++ )
+            dst[i] = Curve::Lerp( from[i], to[i], t );
+    }
+
+    //dst[i] = HermiteBasis::Evaluate(from[i], fromSlopes[i], to[i], toSlopes[i])
+    static void HermiteKeys(const float* from, const float* fromSlopes, const float* to, const float* toSlopes,
+                            const HermiteBasis& basis, float* dst, const std::size_t count)
+    {
+        std::size_t i = 0;
+#ifdef UEM_AVX
+        const auto p0x8 = _mm256_set1_ps( basis.p0 );
+        const auto m0x8 = _mm256_set1_ps( basis.m0 );
+        const auto p1x8 = _mm256_set1_ps( basis.p1 );
+        const auto m1x8 = _mm256_set1_ps( basis.m1 );
+        for ( ; i + 8 <= count; i += 8 )
+        {
+            const auto a = _mm256_add_ps( _mm256_mul_ps( p0x8, _mm256_loadu_ps( from + i ) ),
+                                          _mm256_mul_ps( m0x8, _mm256_loadu_ps( fromSlopes + i ) ) );
+            const auto b = _mm256_add_ps( a, _mm256_mul_ps( p1x8, _mm256_loadu_ps( to + i ) ) );
+            _mm256_storeu_ps( dst + i, _mm256_add_ps( b, _mm256_mul_ps( m1x8, _mm256_loadu_ps( toSlopes + i ) ) ) );
+        }
+#endif
+#ifdef UEM_SSE2
+        const auto p0x4 = _mm_set1_ps( basis.p0 );
+        const auto m0x4 = _mm_set1_ps( basis.m0 );
+        const auto p1x4 = _mm_set1_ps( basis.p1 );
+        const auto m1x4 = _mm_set1_ps( basis.m1 );
+        for ( ; i + 4 <= count; i += 4 )
+        {
+            const auto a = _mm_add_ps( _mm_mul_ps( p0x4, _mm_loadu_ps( from + i ) ), _mm_mul_ps( m0x4, _mm_loadu_ps( fromSlopes + i ) ) );
+            const auto b = _mm_add_ps( a, _mm_mul_ps( p1x4, _mm_loadu_ps( to + i ) ) );
+            _mm_storeu_ps( dst + i, _mm_add_ps( b, _mm_mul_ps( m1x4, _mm_loadu_ps( toSlopes + i ) ) ) );
+        }
+#endif
+        for ( ; i < count; i++ )
+            dst[i] = basis.Evaluate( from[i], fromSlopes[i], to[i], toSlopes[i] );
+    }
+
+    std::size_t GetSamplerRowStride() const
+    {
+        return samplerCubic ? samplerRowSize * 3 : samplerRowSize;
+    }
+
+    void ResetSampler()
+    {
+        poseTransforms.clear();
+        poseSpans.clear();
+        samplerTimes.clear();
+        samplerKeys.clear();
+        samplerConstants.clear();
+        samplerRowSize = 0;
+        samplerCubic = false;
+    }
+
+    //{[bone̐channeltimes̊eԂŋ߂dststrideԊuŏ
+    //]͐KO̐`Ԃ̒l(s̊Ԃ`ԂĂ琳KƁÃL[̊ԂnlerpƓlɂȂ)
+    //outSlopesw肷HermiteȐ̃L[oXƓX(`̃Aj[V̂)
+    void SampleChannel(const std::size_t bone, const int channel, const std::vector<float>& times, float* dst,
+                       const std::size_t stride, float* outSlopes = nullptr, float* inSlopes = nullptr) const
+    {
+        uint32_t key = 0;
+        if ( bone < animationList.size() )
+        {
+            const auto& animation = animationList[bone];
+            const auto& curve = animation.curves[channel];
+            for ( std::size_t i = 0; i < times.size(); i++ )
             {
-                std::string name;
-                ifs >> name;
+                if ( outSlopes != nullptr )
+                {
+                    //]vfƂ̃J[uŕԂĂ琳K̂RotationCurveƓlɂȂ
+                    float value = channel == 6 ? 1.0f : 0.0f, in = 0, out = 0;
+                    if ( !curve.times.empty() )
+                        curve.GetValueAndSlopes( times[i], key, value, in, out );
+                    dst[stride * i] = value;
+                    outSlopes[stride * i] = out;
+                    inSlopes[stride * i] = in;
+                }
+                else if ( IsRotationChannel( channel ) )
+                {
+                    float rotation[4];
+                    animation.rotationCurve.GetValue( times[i], key, rotation, false );
+                    dst[stride * i] = rotation[channel - 3];
+                }
+                else
+                    dst[stride * i] = curve.times.empty() ? 0.0f : curve.GetValue( times[i], key );
+            }
+            return;
+        }
+        const auto& clipBone = clipBoneList[bone - animationList.size()];
+        auto track = 0;
+        while ( channel >= ClipTrackFirstCurves[track + 1] )
+            track++;
+        for ( std::size_t i = 0; i < times.size(); i++ )
+        {
+            float value[4];
+            SampleClipTrack( clipBone.tracks[track], track, times[i] * clipSampleRate, value, key, false );
+            dst[stride * i] = value[channel - ClipTrackFirstCurves[track]];
+        }
+    }
 
-                float tmp[16];
-                for ( auto i = 0; i < 16; i++ )
-                    ifs >> tmp[i];
+    //ǂݍ񂾃gbNSoAɂ܂Ƃ߂
+    void BuildSampler()
+    {
+        ResetSampler();
+        for ( const auto& animation : animationList )
+            poseTransforms.push_back( animation.transform );
+        for ( const auto& bone : clipBoneList )
+            poseTransforms.push_back( bone.transform );
+        const auto boneCount = poseTransforms.size();
 
-                auto trans = m_root->Find( name );
-                model.bones.push_back( std::make_pair(
-                    Matrix{
-                        tmp[0], tmp[4], tmp[8], tmp[12],
-                        tmp[1], tmp[5], tmp[9], tmp[13],
-                        tmp[2], tmp[6], tmp[10], tmp[14],
-                        tmp[3], tmp[7], tmp[11], tmp[15]
-                    }, trans ) );
+        //lω鐬̃L[̎ԂSďW߂(lSē͒萔)
+        std::vector<bool> animated( boneCount * PoseChannelCount );
+        std::vector<float> times;
+        std::size_t keyCount = 0;
+        //]4vf܂Ƃ߂ĕԂĂ琳K̂ŁAǂꂩωΑSĕԂ
+        for ( std::size_t bone = 0; bone < animationList.size(); bone++ )
+        {
+            const auto& animation = animationList[bone];
+            for ( auto channel = 0; channel < PoseChannelCount; channel++ )
+            {
+                if ( IsRotationChannel( channel ) )
+                    continue;
+                const auto& curve = animation.curves[channel];
+                keyCount += curve.times.size() * ( curve.IsHermite() ? 3 : 1 );
+                if ( curve.IsConstant() )
+                    continue;
+                animated[boneCount * channel + bone] = true;
+                times.insert( times.end(), curve.times.begin(), curve.times.end() );
             }
+            const auto& rotation = animation.rotationCurve;
+            keyCount += rotation.keys.size() + rotation.inSlopes.size() + rotation.outSlopes.size();
+            if ( rotation.times.size() > 1 )
+            {
+                for ( auto channel = 3; channel < 7; channel++ )
+                    animated[boneCount * channel + bone] = true;
+                times.insert( times.end(), rotation.times.begin(), rotation.times.end() );
+            }
+        }
+        for ( std::size_t i = 0; i < clipBoneList.size(); i++ )
+        {
+            const auto bone = animationList.size() + i;
+            for ( auto track = 0; track < ClipTrackCount; track++ )
+            {
+                const auto& clipTrack = clipBoneList[i].tracks[track];
+                keyCount += clipTrack.keyCount * ( ClipTrackFirstCurves[track + 1] - ClipTrackFirstCurves[track] );
+                if ( clipTrack.keyCount == 1 )
+                    continue;
+                const auto* data = &clipData[clipTrack.offset];
+                const auto* frames = reinterpret_cast<const uint16_t*>( data );
+                const auto* values = data + ( sizeof( uint16_t ) * clipTrack.keyCount + 3 ) / 4 * 4;
+                float first[4];
+                DecodeClipValue( values, track, 0, first );
+                auto changed = false;
+                for ( uint32_t k = 1; k < clipTrack.keyCount; k++ )
+                {
+                    float value[4];
+                    DecodeClipValue( values, track, k, value );
+                    for ( auto channel = ClipTrackFirstCurves[track]; channel < ClipTrackFirstCurves[track + 1]; channel++ )
+                    {
+                        if ( value[channel - ClipTrackFirstCurves[track]] != first[channel - ClipTrackFirstCurves[track]] )
+                        {
+                            animated[boneCount * channel + bone] = true;
+                            changed = true;
+                        }
+                    }
+                }
+                if ( changed && track == 1 )
+                {
+                    for ( auto channel = 3; channel < 7; channel++ )
+                        animated[boneCount * channel + bone] = true;
+                }
+                if ( changed )
+                {
+                    for ( uint32_t k = 0; k < clipTrack.keyCount; k++ )
+                        times.push_back( frames[k] / clipSampleRate );
+                }
+            }
+        }
+        std::sort( times.begin(), times.end() );
+        times.erase( std::unique( times.begin(), times.end() ), times.end() );
+        //HermiteȐ͌X̂ŁAs͒lƌX23{̑傫ɂȂ(̃L[X̕𐔂Ă)
+        samplerCubic = clipBoneList.empty() &&
+            std::any_of( animationList.begin(), animationList.end(), [](const Animation& animation)
+            {
+                return std::any_of( std::begin( animation.curves ), std::end( animation.curves ),
+                                    [](const Curve& curve) { return curve.IsHermite(); } );
+            } );
+        const auto animatedCount = static_cast<std::size_t>( std::count( animated.begin(), animated.end(), true ) );
+        if ( times.size() * animatedCount * ( samplerCubic ? 3 : 1 ) > keyCount * SamplerMaxKeyRatio )
+        {
+            samplerCubic = false;
+            return;
+        }
 
-            //}eA̓ǂݍ
-            Material material;
-            ifs >> material.name;
-            int colorCount;
-            ifs >> colorCount;
-            for ( auto i1 = 0; i1 < colorCount; i1++ )
+        //PoseƓ(, {[)ŁAԂ邩萔l͈͂܂Ƃ߂
+        const std::vector<float> start{ 0.0f };
+        std::vector<std::size_t> rowPositions( animated.size() );
+        for ( std::size_t index = 0; index < animated.size(); index++ )
+        {
+            const bool isAnimated = animated[index];
+            if ( poseSpans.empty() || poseSpans.back().animated != isAnimated )
+            {
+                const auto source = isAnimated ? samplerRowSize : samplerConstants.size();
+                poseSpans.push_back( PoseSpan{ static_cast<uint32_t>( index ), 0, static_cast<uint32_t>( source ), isAnimated } );
+            }
+            poseSpans.back().count++;
+            if ( isAnimated )
+            {
+                rowPositions[index] = samplerRowSize++;
+                continue;
+            }
+            float value;
+            SampleChannel( index % boneCount, static_cast<int>( index / boneCount ), start, &value, 1 );
+            samplerConstants.push_back( value );
+        }
+
+        //ʂ̃^CC̊eԂŒl߁A̍s𕡐Ă
+        const auto stride = GetSamplerRowStride();
+        samplerTimes.assign( times.begin(), times.end() );
+        samplerKeys.resize( ( times.size() + 1 ) * stride );
+        for ( const auto& span : poseSpans )
+        {
+            if ( !span.animated )
+                continue;
+            for ( uint32_t i = 0; i < span.count; i++ )
+            {
+                const auto index = span.offset + i;
+                auto* dst = &samplerKeys[span.source + i];
+                SampleChannel( index % boneCount, static_cast<int>( index / boneCount ), times, dst, stride,
+                               samplerCubic ? dst + samplerRowSize : nullptr, samplerCubic ? dst + samplerRowSize * 2 : nullptr );
+            }
+        }
+        //Ԃ]͑O̍sƓɂȂ悤𑵂(s̊Ԃ̕ԂŒZoHɂȂ)
+        for ( std::size_t bone = 0; bone < boneCount; bone++ )
+        {
+            if ( !animated[boneCount * 3 + bone] )
+                continue;
+            std::size_t positions[4];
+            for ( auto i = 0; i < 4; i++ )
+                positions[i] = rowPositions[boneCount * ( 3 + i ) + bone];
+            for ( std::size_t row = 1; row < times.size(); row++ )
             {
-                std::string propertyName;
-                ifs >> propertyName;
-                Float4 color;
-                ifs >> color.x >> color.y >> color.z >> color.w;
-                material.AddColor( propertyName, color );
+                const auto* previous = &samplerKeys[stride * ( row - 1 )];
+                auto* current = &samplerKeys[stride * row];
+                auto dot = 0.0f;
+                for ( const auto position : positions )
+                    dot += previous[position] * current[position];
+                if ( dot < 0 )
+                {
+                    //HermiteȐ͌X]
+                    for ( auto offset = 0U; offset < stride; offset += static_cast<uint32_t>( samplerRowSize ) )
+                    {
+                        for ( const auto position : positions )
+                            current[offset + position] = -current[offset + position];
+                    }
+                }
             }
+        }
+        if ( samplerRowSize > 0 )
+            std::copy_n( samplerKeys.end() - stride * 2, stride, samplerKeys.end() - stride );
+    }
 
-            int textureCount;
-            ifs >> textureCount;
-            for ( auto i1 = 0; i1 < textureCount; i1++ )
+    //Aj[V1ǂݍ(hermiteȂL[̌ɌX)
+    //transformName͓ǂݍݗp̍Ɨ̈
+    template <class Stream>
+    void LoadAnimationBinary(Stream& fileStream, Animation& anim, const TransformTable& table,
+                             std::vector<bool>& animated, std::string& transformName, const bool hermite = false)
+    {
+        uint16_t transformNameCount;
+        fileStream.Read( &transformNameCount, sizeof( uint16_t ) );
+        transformName.resize( static_cast<std::size_t>( transformNameCount ) );
+        fileStream.Read( &transformName[0], sizeof( char ) * transformNameCount );
+        anim.transform = Resolve( table, transformName, animated );
+        for ( auto& curve : anim.curves )
+        {
+            uint32_t keyCount;
+            fileStream.Read( &keyCount, sizeof( uint32_t ) );
+            curve.times.resize( keyCount );
+            curve.keys.resize( keyCount );
+            fileStream.Read( &curve.times[0], sizeof( float ) * keyCount );
+            for ( uint32_t t = 0; t < keyCount; t++ )
             {
-                std::string propertyName;
-                ifs >> propertyName;
-                std::string textureName;
-                ifs >> textureName;
-                material.AddTexture( propertyName, filename + "/" + textureName );
+                if ( curve.times[t] > maxAnimationTime )
+                    maxAnimationTime = curve.times[t];
             }
+            fileStream.Read( &curve.keys[0], sizeof( float ) * keyCount );
+            curve.inSlopes.resize( hermite ? keyCount : 0 );
+            curve.outSlopes.resize( hermite ? keyCount : 0 );
+            if ( hermite )
+            {
+                fileStream.Read( &curve.inSlopes[0], sizeof( float ) * keyCount );
+                fileStream.Read( &curve.outSlopes[0], sizeof( float ) * keyCount );
+            }
+        }
+        anim.rotationCurve.Build( &anim.curves[3] );
+    }
+
+    //ǂݍރAj[V̐A[imۂvfpӂ
+    void ResetAnimationList(const std::size_t animationCount, const TransformTable& table)
+    {
+        clipBoneList.clear();
+        clipData.clear();
+        clipSampleRate = 0;
+        ResetSampler();
+        animationList.clear();
+        animationList.reserve( animationCount + table.GetCount() );
+        for ( std::size_t i = 0; i < animationCount; i++ )
+            animationList.emplace_back( m_arena.get() );
+    }
+
+    //RpNg`̃{[̐vfpӂAgbÑf[^͌Œp̃{[̕ňxɊmۂ
+    void ResetClip(const ClipInfo& info, const TransformTable& table)
+    {
+        ResetSampler();
+        animationList.clear();
+        clipSampleRate = info.sampleRate;
+        maxAnimationTime = std::max<float>( maxAnimationTime, info.duration );
+        clipBoneList.assign( info.boneCount, ClipBone{} );
+        clipData.clear();
+        std::size_t constantSize = 0;
+        for ( auto track = 0; track < ClipTrackCount; track++ )
+            constantSize += GetClipTrackSize( 1, track );
+        const auto fixedCount = static_cast<std::size_t>( table.GetCount() ) > info.boneCount ? table.GetCount() - info.boneCount : 0;
+        clipData.reserve( info.dataSize + constantSize * fixedCount );
+    }
+
+    //RpNg`̃{[1{ǂݍ(gbÑf[^͂̂܂clipData)
+    template <class Stream>
+    bool LoadClipBone(Stream& fileStream, ClipBone& bone, const TransformTable& table, std::vector<bool>& animated,
+                      std::string& transformName)
+    {
+        uint16_t transformNameCount;
+        fileStream.Read( &transformNameCount, sizeof( uint16_t ) );
+        transformName.resize( static_cast<std::size_t>( transformNameCount ) );
+        fileStream.Read( &transformName[0], sizeof( char ) * transformNameCount );
+        bone.transform = Resolve( table, transformName, animated );
+        for ( auto track = 0; track < ClipTrackCount; track++ )
+        {
+            uint32_t keyCount;
+            fileStream.Read( &keyCount, sizeof( uint32_t ) );
+            if ( keyCount == 0 || keyCount > ClipMaxKeyCount )
+                return false;
+            const auto size = GetClipTrackSize( keyCount, track );
+            bone.tracks[track] = ClipTrack{ static_cast<uint32_t>( clipData.size() ), keyCount };
+            clipData.resize( clipData.size() + size );
+            fileStream.Read( &clipData[bone.tracks[track].offset], static_cast<int>( size ) );
+        }
+        return true;
+    }
+
+    //萔̃gbNǉ
+    ClipTrack AddClipConstant(const void* value, const int track)
+    {
+        const ClipTrack clipTrack{ static_cast<uint32_t>( clipData.size() ), 1 };
+        clipData.resize( clipData.size() + GetClipTrackSize( 1, track ) );
+        std::memcpy( &clipData[clipTrack.offset], value, ClipTrackValueSizes[track] );
+        return clipTrack;
+    }
+
+    static void DecodeClipValue(const char* values, const int track, const std::size_t index, float (&value)[4])
+    {
+        if ( track == 1 )
+        {
+            Quaternion48 rotation;
+            std::memcpy( &rotation, values + sizeof( Quaternion48 ) * index, sizeof( Quaternion48 ) );
+            rotation.Decode( value );
+        }
+        else
+            std::memcpy( value, values + sizeof( float ) * 3 * index, sizeof( float ) * 3 );
+    }
 
-            auto materialNo = -1;
-            for ( auto j = 0; j < static_cast<int>( m_materials.size() ); j++ )
+    //frame( * Tv[g)ł̒lvfƂ̐`Ԃŋ߂(]͍ŒZoHnlerpAnormalizefalseȂ琳KȂ)
+    //key͑Oframe̍ŏ̃L[(Curve::FindKeyƓ߂ɂ΂̂܂܎g)
+    void SampleClipTrack(const ClipTrack& clipTrack, const int track, const float frame, float (&value)[4],
+                         uint32_t& key, const bool normalize = true) const
+    {
+        const auto* data = &clipData[clipTrack.offset];
+        const auto keyCount = clipTrack.keyCount;
+        if ( keyCount == 1 )
+        {
+            DecodeClipValue( data, track, 0, value );
+            return;
+        }
+        const auto* frames = reinterpret_cast<const uint16_t*>( data );
+        const auto* values = data + ( sizeof( uint16_t ) * keyCount + 3 ) / 4 * 4;
+        auto inside = [&](const uint32_t i)
+        {
+            return i <= keyCount && ( i == 0 || frames[i - 1] <= frame ) && ( i == keyCount || frame < frames[i] );
+        };
+        auto index = key;
+        if ( !inside( index ) && !inside( ++index ) )
+            index = static_cast<uint32_t>( std::upper_bound( frames, frames + keyCount, frame ) - frames );
+        key = index;
+        if ( index == 0 || index == keyCount )
+        {
+            DecodeClipValue( values, track, index == 0 ? 0 : keyCount - 1, value );
+            return;
+        }
+        float from[4], to[4];
+        DecodeClipValue( values, track, index - 1, from );
+        DecodeClipValue( values, track, index, to );
+        const auto t = ( frame - frames[index - 1] ) / static_cast<float>( frames[index] - frames[index - 1] );
+        if ( track == 1 )
+        {
+            if ( from[0] * to[0] + from[1] * to[1] + from[2] * to[2] + from[3] * to[3] < 0 )
             {
-                if ( m_materials[j] == material.name )
-                    materialNo = j;
+                for ( auto& v : to )
+                    v = -v;
             }
-            if ( materialNo == -1 )
+            if ( normalize )
+                NlerpQuaternion( from, to, t, value );
+            else
             {
-                materialNo = static_cast<int>( m_materials.size() );
-                m_materials.push_back( material );
+                for ( auto i = 0; i < 4; i++ )
+                    value[i] = Curve::Lerp( from[i], to[i], t );
             }
-            model.materialNo = materialNo;
-            m_meshes.push_back( model );
+            return;
         }
+        for ( auto i = 0; i < 3; i++ )
+            value[i] = Curve::Lerp( from[i], to[i], t );
     }
 
-    void LoadBinary(std::string filename)
+    void SetClipTransform(const ClipBone& bone, const float frame, uint32_t* keys) const
     {
-        m_root = std::make_unique<Transform>();
-
-        FileStream fileStream( filename.c_str() );
-        auto lastSlash = filename.find_last_of( '/' );
-        filename.erase( lastSlash );
-
-        LoadHierarchyBinary( fileStream );
+        if ( !bone.transform )
+            return;
+        float values[ClipTrackCount][4];
+        for ( auto track = 0; track < ClipTrackCount; track++ )
+            SampleClipTrack( bone.tracks[track], track, frame, values[track], keys[track] );
+        const Float3 position = { values[0][0], values[0][1], values[0][2] };
+        const Vector4 rotation = { { values[1][0], values[1][1], values[1][2], values[1][3] } };
+        const Float3 scale = { values[2][0], values[2][1], values[2][2] };
 
-        short vertexFormat;
-        fileStream.Read( &vertexFormat, sizeof( short ) );
+        bone.transform->m_position = position;
+        bone.transform->m_rotation = rotation;
+        bone.transform->m_scale = scale;
+    }
 
-        uint16_t modelCount;
-        fileStream.Read( &modelCount, sizeof( uint16_t ) );
+    static Transform* Resolve(const TransformTable& table, const std::string_view name, std::vector<bool>& animated)
+    {
+        const auto index = table.Find( name );
+        if ( index < 0 )
+            return nullptr;
+        animated[index] = true;
+        return table.Get( index );
+    }
 
-        //tH[}bgG[`FbN
-        std::vector<bool> formatFlg;
-        formatFlg.resize( 12 );
-        auto totalByte = 32; //BoneIndex & BoneWeight
-        for ( auto i = 0; i < VertexFormatSizes.size(); i++ )
-            if ( vertexFormat & static_cast<short>(VertexFormatSizes[i].first) )
-                totalByte += VertexFormatSizes[i].second;
-        if ( totalByte != sizeof( X ) )
+    //Aj[V̖Transform݂͌̎p̂܂܌Œ肷Aj[Vǉ
+    void CheckTransform(const TransformTable& table, const std::vector<bool>& animated)
+    {
+        if ( clipSampleRate > 0 )
+            clipBoneList.reserve( clipBoneList.size() + std::count( animated.begin(), animated.end(), false ) );
+        for ( auto i = 0; i < table.GetCount(); i++ )
         {
-            auto errorLog = std::string( typeid( X ).name() ) + " is " + std::to_string( sizeof( X ) ) + "\n " +
-                "The required size is " + std::to_string( totalByte ) + " bytes";
-            std::cout << errorLog;
-            return;
+            if ( animated[i] )
+                continue;
+            auto* transform = table.Get( i );
+            if ( clipSampleRate > 0 )
+            {
+                //RpNg`ł͒萔̃gbÑ{[ɂ
+                const float rotation[4] = {
+                    transform->m_rotation.x, transform->m_rotation.y, transform->m_rotation.z, transform->m_rotation.w
+                };
+                const auto packedRotation = Quaternion48::Encode( rotation );
+                ClipBone bone;
+                bone.transform = transform;
+                bone.tracks[0] = AddClipConstant( &transform->m_position, 0 );
+                bone.tracks[1] = AddClipConstant( &packedRotation, 1 );
+                bone.tracks[2] = AddClipConstant( &transform->m_scale, 2 );
+                clipBoneList.push_back( bone );
+                continue;
+            }
+            Animation work( m_arena.get() );
+            work.transform = transform;
+            work.curves[0].keys.push_back(transform->m_position.x);
+            work.curves[0].times.push_back(0);
+            work.curves[1].keys.push_back(transform->m_position.y);
+            work.curves[1].times.push_back(0);
+            work.curves[2].keys.push_back(transform->m_position.z);
+            work.curves[2].times.push_back(0);
+            work.curves[3].keys.push_back(transform->m_rotation.x);
+            work.curves[3].times.push_back(0);
+            work.curves[4].keys.push_back(transform->m_rotation.y);
+            work.curves[4].times.push_back(0);
+            work.curves[5].keys.push_back(transform->m_rotation.z);
+            work.curves[5].times.push_back(0);
+            work.curves[6].keys.push_back(transform->m_rotation.w);
+            work.curves[6].times.push_back(0);
+            work.curves[7].keys.push_back(transform->m_scale.x);
+            work.curves[7].times.push_back(0);
+            work.curves[8].keys.push_back(transform->m_scale.y);
+            work.curves[8].times.push_back(0);
+            work.curves[9].keys.push_back(transform->m_scale.z);
+            work.curves[9].times.push_back(0);
+
+            work.rotationCurve.Build( &work.curves[3] );
+            animationList.push_back( std::move( work ) );
         }
+    }
+};
 
-        for ( auto i = 0; i < modelCount; i++ )
-        {
-            Mesh model;
-            //_ǂݍ
-            uint32_t vertexCount;
-            fileStream.Read( &vertexCount, sizeof( uint32_t ) );
-            model.vertexDatas.resize( vertexCount );
-            fileStream.Read( &model.vertexDatas[0], sizeof( X ) * vertexCount );
+//̃Nbv̎p(NXtF[hE1D/2D̃uhXy[XE㏑/Z̃C[)
+//NbvƂɕт̈ႤPoseXPg̕(TransformTable̔ԍ)ɕבւĂAƂ̔z܂Ƃ߂č
+//pApplyPoseŃt[1񂾂Transformɏ
+//ǉSkinnedAnimationAnimationBlender蒷ێ邱
+class AnimationBlender
+{
+public:
+    using Pose = SkinnedAnimation::Pose;
 
-            //CfbNXǂݍ
-            uint32_t indexCount;
-            fileStream.Read( &indexCount, sizeof( uint32_t ) );
-            model.indexes.resize( indexCount );
-            fileStream.Read( &model.indexes[0], sizeof( uint32_t ) * indexCount );
+    //SampleBlendōNbv1
+    struct BlendInput
+    {
+        std::size_t clip; //AddClip̖߂l
+        float time;
+        float weight;
+    };
 
-            //x[X|[Yǂݍ
-            uint16_t basePoseCount;
-            fileStream.Read( &basePoseCount, sizeof( uint16_t ) );
-            for ( auto j = 0; j < basePoseCount; j++ )
-            {
-                std::string name;
-                uint16_t nameCount;
-                fileStream.Read( &nameCount, sizeof( uint16_t ) );
-                name.resize( nameCount );
-                fileStream.Read( &name[0], sizeof( char ) * nameCount );
+    AnimationBlender() = default;
 
-                Matrix tmp;
-                fileStream.Read( &tmp, sizeof( float ) * 16 );
+    explicit AnimationBlender(const TransformTable& table)
+    {
+        Reset( table );
+    }
 
-                auto trans = m_root->Find( name );
-                model.bones.push_back( std::make_pair( Transpose( tmp ), trans ) );
-            }
+    //XPg̃{[ƍTransform̒l(ǂ̃NbvȂ{[̎p)oANbvSĊO
+    void Reset(const TransformTable& table)
+    {
+        clips.clear();
+        transforms.resize( static_cast<std::size_t>( table.GetCount() ) );
+        restPose.Resize( transforms.size() );
+        for ( std::size_t bone = 0; bone < transforms.size(); bone++ )
+        {
+            const auto* transform = transforms[bone] = table.Get( static_cast<int>( bone ) );
+            const float values[SkinnedAnimation::PoseChannelCount] = {
+                transform->m_position.x, transform->m_position.y, transform->m_position.z,
+                transform->m_rotation.x, transform->m_rotation.y, transform->m_rotation.z, transform->m_rotation.w,
+                transform->m_scale.x, transform->m_scale.y, transform->m_scale.z
+            };
+            for ( auto channel = 0; channel < SkinnedAnimation::PoseChannelCount; channel++ )
+                restPose.GetChannel( channel )[bone] = values[channel];
+        }
+    }
 
-            //}eA̓ǂݍ
-            Material material;
-            uint16_t materialNameCount;
-            fileStream.Read( &materialNameCount, sizeof( uint16_t ) );
-            material.name.resize( materialNameCount );
-            fileStream.Read( &material.name[0], sizeof( char ) * materialNameCount );
-
-            uint16_t colorCount;
-            fileStream.Read( &colorCount, sizeof( uint16_t ) );
-            for ( auto i1 = 0; i1 < colorCount; i1++ )
-            {
-                std::string propertyName;
-                uint16_t propertyNameCount;
-                fileStream.Read( &propertyNameCount, sizeof( uint16_t ) );
-                propertyName.resize( propertyNameCount );
-                fileStream.Read( &propertyName[0], sizeof( char ) * propertyNameCount );
-
-                Float4 color;
-                fileStream.Read( &color, sizeof( float ) * 4 );
-                material.AddColor( propertyName, color );
-            }
-
-            uint16_t textureCount;
-            fileStream.Read( &textureCount, sizeof( uint16_t ) );
-            for ( auto i1 = 0; i1 < textureCount; i1++ )
-            {
-                std::string propertyName;
-                uint16_t propertyNameCount;
-                fileStream.Read( &propertyNameCount, sizeof( uint16_t ) );
-                propertyName.resize( propertyNameCount );
-                fileStream.Read( &propertyName[0], sizeof( char ) * propertyNameCount );
-
-                std::string textureName;
-                uint16_t textureNameCount;
-                fileStream.Read( &textureNameCount, sizeof( uint16_t ) );
-                if ( textureNameCount == 0 )
-                {
-                    material.AddTexture( propertyName, "null" );
-                    continue;
-                }
-                textureName.resize( textureNameCount );
-                fileStream.Read( &textureName[0], sizeof( char ) * textureNameCount );
-                material.AddTexture( propertyName, filename + "/" + textureName );
-            }
+    //NbvǉĔԍԂ(NbvPosẽ{[XPĝǂ̃{[͂ňx߂)
+    std::size_t AddClip(const SkinnedAnimation& animation)
+    {
+        std::unordered_map<const Transform*, uint32_t> indexes;
+        for ( std::size_t bone = 0; bone < transforms.size(); bone++ )
+            indexes.emplace( transforms[bone], static_cast<uint32_t>( bone ) );
+        Clip clip;
+        clip.animation = &animation;
+        std::vector<bool> covered( transforms.size() );
+        for ( std::size_t bone = 0; bone < animation.GetPoseBoneCount(); bone++ )
+        {
+            const auto itr = indexes.find( animation.GetPoseTransform( bone ) );
+            clip.bones.push_back( itr != indexes.end() ? itr->second : NoBone );
+            if ( itr != indexes.end() )
+                covered[itr->second] = true;
+        }
+        clip.complete = std::all_of( covered.begin(), covered.end(), [](const bool value) { return value; } );
+        clips.push_back( std::move( clip ) );
+        return clips.size() - 1;
+    }
+
+    std::size_t GetBoneCount() const
+    {
+        return transforms.size();
+    }
 
-            auto materialNo = -1;
-            for ( auto j = 0; j < static_cast<int>( m_materials.size() ); j++ )
+    //Reset̎p(Z̃C[̊ȂǂɎg)
+    const Pose& GetRestPose() const
+    {
+        return restPose;
+    }
+
+    //cliptimeł̎pXPg̕тposeɏ(NbvȂ{[Reset̎p)
+    void SampleClip(const std::size_t clip, const float time, Pose& pose)
+    {
+        auto& source = clips[clip];
+        source.animation->Sample( time, source.cursor, source.pose );
+        pose.Resize( transforms.size() );
+        if ( !source.complete )
+            std::copy( restPose.channels.begin(), restPose.channels.end(), pose.channels.begin() );
+        const auto count = std::min<std::size_t>( source.bones.size(), source.pose.boneCount );
+        for ( auto channel = 0; channel < SkinnedAnimation::PoseChannelCount; channel++ )
+        {
+            const auto* src = source.pose.GetChannel( channel );
+            auto* dst = pose.GetChannel( channel );
+            for ( std::size_t bone = 0; bone < count; bone++ )
             {
-                if ( m_materials[j] == material.name )
-                    materialNo = j;
+                if ( source.bones[bone] != NoBone )
+                    dst[source.bones[bone]] = src[bone];
             }
-            if ( materialNo == -1 )
+        }
+    }
+
+    //inputs̃Nbvd݂̔䗦ōposeɏ(d݂͍vŊA0ȉ̂̂̓TvOȂ)
+    //uhXy[XGetBlendWeights1D/GetBlendWeights2Dŋ߂d݂̂܂ܓn
+    //]͍̒lƓɑđ킹Ă琳K
+    void SampleBlend(const BlendInput* inputs, const std::size_t count, Pose& pose)
+    {
+        auto total = 0.0f;
+        for ( std::size_t i = 0; i < count; i++ )
+            total += std::max<float>( inputs[i].weight, 0.0f );
+        pose.Resize( transforms.size() );
+        if ( !( total > 0 ) )
+        {
+            std::copy( restPose.channels.begin(), restPose.channels.end(), pose.channels.begin() );
+            return;
+        }
+        const auto boneCount = pose.boneCount;
+        auto first = true;
+        for ( std::size_t i = 0; i < count; i++ )
+        {
+            if ( !( inputs[i].weight > 0 ) )
+                continue;
+            SampleClip( inputs[i].clip, inputs[i].time, samplePose );
+            const auto weight = inputs[i].weight / total;
+            if ( first )
             {
-                materialNo = static_cast<int>( m_materials.size() );
-                m_materials.push_back( material );
+                ScaleValues( samplePose.channels.data(), weight, pose.channels.data(), pose.channels.size() );
+                first = false;
+                continue;
             }
-            model.materialNo = materialNo;
-            m_meshes.push_back( model );
+            AddScaledValues( samplePose.GetChannel( 0 ), weight, pose.GetChannel( 0 ), boneCount * 3 );
+            AddScaledRotations( samplePose, weight, pose );
+            AddScaledValues( samplePose.GetChannel( 7 ), weight, pose.GetChannel( 7 ), boneCount * 3 );
         }
+        NormalizePoseRotations( pose );
     }
-};
 
-struct SkinnedAnimation
-{
-    struct Curve
+    //fromtoweight̔䗦ŕԂdstɏ(NXtF[hE㏑̃C[AdstfromtoƓł悢)
+    //boneWeightsw肷ƃXPg̕т̃{[Ƃ̏d݂|(㔼g̃C[Ȃǂ̃}XN)
+    void LerpPose(const Pose& from, const Pose& to, const float weight, Pose& dst, const float* boneWeights = nullptr)
     {
-        std::vector<float> times;
-        std::vector<float> keys;
+        const auto boneCount = std::min<std::size_t>( from.boneCount, to.boneCount );
+        weights.resize( boneCount );
+        for ( std::size_t bone = 0; bone < boneCount; bone++ )
+            weights[bone] = boneWeights != nullptr ? boneWeights[bone] * weight : weight;
+        //dst͂ƓŃ{[ςꍇAResizeƓ͂̃`l̈ʒûŕʂ̎pɏłւ
+        const auto aliased = ( &dst == &from || &dst == &to ) && dst.boneCount != boneCount;
+        auto& out = aliased ? lerpPose : dst;
+        out.Resize( boneCount );
+        for ( const auto channel : { 0, 1, 2, 7, 8, 9 } )
+            LerpValues( from.GetChannel( channel ), to.GetChannel( channel ), weights.data(), out.GetChannel( channel ), boneCount );
+        LerpRotations( from, to, weights.data(), out );
+        NormalizePoseRotations( out );
+        if ( aliased )
+            std::swap( dst, lerpPose );
+    }
 
-        static float Lerp(const float f1, const float f2, const float t)
+    //basereferenceadditiveւ̕ωweight̔䗦ŉdstɏ(Z̃C[AdstbaseƓł悢)
+    //ʒuƃXP[͍𑫂A]referenceadditiveւ̉]({[̃[J)weight̔䗦Ŋ|
+    static void AddPose(const Pose& base, const Pose& additive, const Pose& reference, const float weight, Pose& dst)
+    {
+        const auto boneCount = std::min<std::size_t>( { base.boneCount, additive.boneCount, reference.boneCount } );
+        //dst͂ƓŃ{[ςꍇ́ALerpPoseƓʂ̎pɏłւ
+        Pose result;
+        const auto aliased = ( &dst == &base || &dst == &additive || &dst == &reference ) && dst.boneCount != boneCount;
+        auto& out = aliased ? result : dst;
+        out.Resize( boneCount );
+        for ( const auto channel : { 0, 1, 2, 7, 8, 9 } )
         {
-            return f1 + ( f2 - f1 ) * t;
+            AddDifferences( base.GetChannel( channel ), additive.GetChannel( channel ), reference.GetChannel( channel ), weight,
+                            out.GetChannel( channel ), boneCount );
         }
+        AddRotations( base, additive, reference, weight, out );
+        NormalizePoseRotations( out );
+        if ( aliased )
+            dst = std::move( result );
+    }
 
-        float GetValue(const float time)
+    //1D̃uhXy[X̏d(positions͏̃Nbv̈ʒuA͈͊O͒[̃Nbv)
+    static void GetBlendWeights1D(const float* positions, const std::size_t count, const float parameter, float* dst)
+    {
+        std::fill_n( dst, count, 0.0f );
+        if ( count == 0 )
+            return;
+        if ( !( parameter > positions[0] ) )
         {
-            if ( times.size() == 1 )
-                return keys[0];
-            if ( time < times[0] )
-                return keys[0];
-            if ( time > times[times.size() - 1] )
-                return keys[keys.size() - 1];
+            dst[0] = 1;
+            return;
+        }
+        if ( parameter >= positions[count - 1] )
+        {
+            dst[count - 1] = 1;
+            return;
+        }
+        const auto index = static_cast<std::size_t>( std::upper_bound( positions, positions + count, parameter ) - positions ) - 1;
+        const auto t = ( parameter - positions[index] ) / ( positions[index + 1] - positions[index] );
+        dst[index] = 1 - t;
+        dst[index + 1] = t;
+    }
 
-            auto index = 0UL;
-            for ( ; index < times.size() - 1; index++ )
+    //2D̃uhXy[X̏d(zѕԁApositions̓Nbv̈ʒu)
+    //Nbv̈ʒuł͑̃Nbv̏d݂0ɂȂÅԂ͋߂NbvقǏdȂ(v1)
+    static void GetBlendWeights2D(const Float2* positions, const std::size_t count, const Float2& parameter, float* dst)
+    {
+        auto total = 0.0f;
+        for ( std::size_t i = 0; i < count; i++ )
+        {
+            auto weight = 1.0f;
+            for ( std::size_t j = 0; j < count && weight > 0; j++ )
             {
-                if ( times[index] > time )
-                    break;
+                const auto dx = positions[j].x - positions[i].x;
+                const auto dy = positions[j].y - positions[i].y;
+                const auto length = dx * dx + dy * dy;
+                if ( i == j || !( length > 0 ) )
+                    continue;
+                const auto projection = ( ( parameter.x - positions[i].x ) * dx + ( parameter.y - positions[i].y ) * dy ) / length;
+                weight = std::min<float>( weight, 1 - projection );
             }
-            index--;
-
-            return Lerp( keys[index], keys[index + 1], ( time - times[index] ) / ( times[index + 1] - times[index] ) );
+            dst[i] = std::max<float>( weight, 0.0f );
+            total += dst[i];
         }
-    };
+        for ( std::size_t i = 0; i < count; i++ )
+            dst[i] = total > 0 ? dst[i] / total : ( i == 0 ? 1.0f : 0.0f );
+    }
 
-    struct Animation
+    //poseXPgTransformɏ
+    void ApplyPose(const Pose& pose) const
     {
-        Transform* transform = nullptr;
-        Curve curves[10];
-
-        void SetTransform(const float time)
+        const auto count = std::min<std::size_t>( pose.boneCount, transforms.size() );
+        for ( std::size_t bone = 0; bone < count; bone++ )
         {
-            if (!transform)
-                return;
-            const Float3 position = {
-                curves[0].GetValue( time ), curves[1].GetValue( time ),
-                curves[2].GetValue( time )
-            };
-            const Vector4 rotation = { {
-                curves[3].GetValue(time), curves[4].GetValue(time),
-                curves[5].GetValue(time), curves[6].GetValue(time)
-            } };
-            const Float3 scale = {
-                curves[7].GetValue( time ), curves[8].GetValue( time ),
-                curves[9].GetValue( time )
-            };
+            auto* transform = transforms[bone];
+            const auto* value = pose.channels.data() + bone;
+            const auto stride = pose.boneCount;
+            const Float3 position = { value[0], value[stride], value[stride * 2] };
+            const Vector4 rotation = { { value[stride * 3], value[stride * 4], value[stride * 5], value[stride * 6] } };
+            const Float3 scale = { value[stride * 7], value[stride * 8], value[stride * 9] };
 
             transform->m_position = position;
             transform->m_rotation = rotation;
             transform->m_scale = scale;
         }
-    };
+    }
 
 private:
-    std::vector<Animation> animationList;
-    float maxAnimationTime = 0;
-public:
-    void LoadAscii(std::string filename, Transform* root)
+    static constexpr uint32_t NoBone = ( std::numeric_limits<uint32_t>::max )();
+
+    struct Clip
     {
-        std::ifstream ifs( filename );
-        const auto lastSlash = filename.find_last_of( '/' );
-        filename.erase( lastSlash );
-        assert( ifs.is_open() );
+        const SkinnedAnimation* animation = nullptr;
+        SkinnedAnimation::Cursor cursor;
+        Pose pose; //Nbv̕т̎p
+        std::vector<uint32_t> bones; //NbvPosẽ{[Ƃ̃XPg̔ԍ(NoBone)
+        bool complete = false; //XPg̑SẴ{[𓮂
+    };
 
-        int animationCount;
-        ifs >> animationCount;
-        animationList.resize( animationCount );
-        for ( auto i = 0; i < animationCount; i++ )
-        {
-            auto& anim = animationList[i];
-            std::string transformName;
-            ifs >> transformName;
-            anim.transform = root->Find( transformName );
-            for ( auto& curve : anim.curves )
-            {
-                int keyCount;
-                ifs >> keyCount;
-                curve.times.resize( keyCount );
-                curve.keys.resize( keyCount );
-                for ( auto k = 0; k < keyCount; k++ )
-                {
-                    ifs >> curve.times[k];
-                    if ( curve.times[k] > maxAnimationTime )
-                        maxAnimationTime = curve.times[k];
-                }
-                for ( auto k = 0; k < keyCount; k++ )
-                    ifs >> curve.keys[k];
-            }
-        }
-        CheckTransform(root);
+    std::vector<Transform*> transforms; //XPg̕(TransformTableƓ)
+    Pose restPose;
+    std::vector<Clip> clips;
+    Pose samplePose; //SampleBlendp
+    std::vector<float> weights; //LerpPosep̃{[Ƃ̏d
+    Pose lerpPose; //LerpPosedst͂ƓŃ{[ςꍇ̏ݐ
+
+    static void NormalizePoseRotations(Pose& pose)
+    {
+        NormalizeQuaternions( pose.GetChannel( 3 ), pose.GetChannel( 4 ), pose.GetChannel( 5 ), pose.GetChannel( 6 ), pose.boneCount );
     }
 
-    void LoadBinary(const std::string& filename, Transform* root)
+    //dst[i] = src[i] * weight
+    static void ScaleValues(const float* src, const float weight, float* dst, const std::size_t count)
     {
-        FileStream fileStream( filename.c_str() );
+        std::size_t i = 0;
+#ifdef UEM_SSE2
+        const auto w = _mm_set1_ps( weight );
+        for ( ; i + 4 <= count; i += 4 )
+            _mm_storeu_ps( dst + i, _mm_mul_ps( _mm_loadu_ps( src + i ), w ) );
+#endif
+        for ( ; i < count; i++ )
+            dst[i] = src[i] * weight;
+    }
 
-        uint32_t animationCount;
-        fileStream.Read( &animationCount, sizeof( uint32_t ) );
+    //dst[i] += src[i] * weight
+    static void AddScaledValues(const float* src, const float weight, float* dst, const std::size_t count)
+    {
+        std::size_t i = 0;
+#ifdef UEM_SSE2
+        const auto w = _mm_set1_ps( weight );
+        for ( ; i + 4 <= count; i += 4 )
+            _mm_storeu_ps( dst + i, _mm_add_ps( _mm_loadu_ps( dst + i ), _mm_mul_ps( _mm_loadu_ps( src + i ), w ) ) );
+#endif
+        for ( ; i < count; i++ )
+            dst[i] += src[i] * weight;
+    }
 
-        animationList.resize( animationCount );
-        for ( uint32_t i = 0; i < animationCount; i++ )
+    //dst[i] = from[i] + (to[i] - from[i]) * weights[i]
+    static void LerpValues(const float* from, const float* to, const float* weights, float* dst, const std::size_t count)
+    {
+        std::size_t i = 0;
+#ifdef UEM_SSE2
+        for ( ; i + 4 <= count; i += 4 )
         {
-            auto& anim = animationList[i];
-            std::string transformName;
-            uint16_t transformNameCount;
-            fileStream.Read( &transformNameCount, sizeof( uint16_t ) );
-            transformName.resize( static_cast<std::size_t>( transformNameCount ) );
-            fileStream.Read( &transformName[0], sizeof( char ) * transformNameCount );
-            anim.transform = root->Find( transformName );
-            for ( auto& curve : anim.curves )
-            {
-                uint32_t keyCount;
-                fileStream.Read( &keyCount, sizeof( uint32_t ) );
-                curve.times.resize( keyCount );
-                curve.keys.resize( keyCount );
-                fileStream.Read( &curve.times[0], sizeof( float ) * keyCount );
-                for ( uint32_t t = 0; t < keyCount; t++ )
-                {
-                    if ( curve.times[t] > maxAnimationTime )
-                        maxAnimationTime = curve.times[t];
-                }
-                fileStream.Read( &curve.keys[0], sizeof( float ) * keyCount );
-            }
+            const auto a = _mm_loadu_ps( from + i );
+            const auto b = _mm_loadu_ps( to + i );
+            _mm_storeu_ps( dst + i, _mm_add_ps( a, _mm_mul_ps( _mm_sub_ps( b, a ), _mm_loadu_ps( weights + i ) ) ) );
         }
-        CheckTransform(root);
+#endif
+        for ( ; i < count; i++ )
+            dst[i] = from[i] + ( to[i] - from[i] ) * weights[i];
     }
 
-    void SetTransform(const float time)
+    //dst[i] = base[i] + (additive[i] - reference[i]) * weight
+    static void AddDifferences(const float* base, const float* additive, const float* reference, const float weight, float* dst,
+                               const std::size_t count)
     {
-        for ( auto& animation : animationList )
-            animation.SetTransform( time );
+        std::size_t i = 0;
+#ifdef UEM_SSE2
+        const auto w = _mm_set1_ps( weight );
+        for ( ; i + 4 <= count; i += 4 )
+        {
+            const auto difference = _mm_sub_ps( _mm_loadu_ps( additive + i ), _mm_loadu_ps( reference + i ) );
+            _mm_storeu_ps( dst + i, _mm_add_ps( _mm_loadu_ps( base + i ), _mm_mul_ps( difference, w ) ) );
+        }
+#endif
+        for ( ; i < count; i++ )
+            dst[i] = base[i] + ( additive[i] - reference[i] ) * weight;
+    }
+
+    //]4̐̔z
+    struct Rotations
+    {
+        const float* value[4];
+
+        explicit Rotations(const Pose& pose)
+            : value{ pose.GetChannel( 3 ), pose.GetChannel( 4 ), pose.GetChannel( 5 ), pose.GetChannel( 6 ) }
+        {
+        }
     };
 
-    float GetMaxAnimationTime() const
+    //dst̉]src̉]weight{đ(dstƓςȂsrc̕𔽓])
+    static void AddScaledRotations(const Pose& src, const float weight, Pose& dst)
     {
-        return maxAnimationTime;
+        const Rotations s( src );
+        float* d[4] = { dst.GetChannel( 3 ), dst.GetChannel( 4 ), dst.GetChannel( 5 ), dst.GetChannel( 6 ) };
+        const auto count = std::min<std::size_t>( src.boneCount, dst.boneCount );
+        std::size_t i = 0;
+#ifdef UEM_SSE2
+        const auto w4 = _mm_set1_ps( weight );
+        const auto signBit = _mm_set1_ps( -0.0f );
+        for ( ; i + 4 <= count; i += 4 )
+        {
+            __m128 a[4], b[4];
+            for ( auto c = 0; c < 4; c++ )
+            {
+                a[c] = _mm_loadu_ps( d[c] + i );
+                b[c] = _mm_loadu_ps( s.value[c] + i );
+            }
+            const auto dot = Dot4( a, b );
+            const auto w = _mm_xor_ps( w4, _mm_and_ps( _mm_cmplt_ps( dot, _mm_setzero_ps() ), signBit ) );
+            for ( auto c = 0; c < 4; c++ )
+                _mm_storeu_ps( d[c] + i, _mm_add_ps( a[c], _mm_mul_ps( b[c], w ) ) );
+        }
+#endif
+        for ( ; i < count; i++ )
+        {
+            const auto dot = ( d[0][i] * s.value[0][i] + d[1][i] * s.value[1][i] ) + ( d[2][i] * s.value[2][i] + d[3][i] * s.value[3][i] );
+            const auto w = dot < 0 ? -weight : weight;
+            for ( auto c = 0; c < 4; c++ )
+                d[c][i] += s.value[c][i] * w;
+        }
     }
 
-private:
-    void CheckTransform(Transform* transform)
+    //]{[Ƃ̏d݂ŕԂ(ŒZoHɂȂ悤to𑵂̕AK͂Ȃ)
+    static void LerpRotations(const Pose& from, const Pose& to, const float* weights, Pose& dst)
     {
-        auto itr =std::find_if(animationList.begin(), animationList.end(),
-            [transform](const Animation& anim)
+        const Rotations a( from );
+        const Rotations b( to );
+        float* d[4] = { dst.GetChannel( 3 ), dst.GetChannel( 4 ), dst.GetChannel( 5 ), dst.GetChannel( 6 ) };
+        const auto count = dst.boneCount;
+        std::size_t i = 0;
+#ifdef UEM_SSE2
+        const auto signBit = _mm_set1_ps( -0.0f );
+        for ( ; i + 4 <= count; i += 4 )
+        {
+            __m128 va[4], vb[4];
+            for ( auto c = 0; c < 4; c++ )
             {
-                return anim.transform == transform;
-            });
-        if(itr == animationList.end())
+                va[c] = _mm_loadu_ps( a.value[c] + i );
+                vb[c] = _mm_loadu_ps( b.value[c] + i );
+            }
+            const auto sign = _mm_and_ps( _mm_cmplt_ps( Dot4( va, vb ), _mm_setzero_ps() ), signBit );
+            const auto w = _mm_loadu_ps( weights + i );
+            for ( auto c = 0; c < 4; c++ )
+                _mm_storeu_ps( d[c] + i, _mm_add_ps( va[c], _mm_mul_ps( _mm_sub_ps( _mm_xor_ps( vb[c], sign ), va[c] ), w ) ) );
+        }
+#endif
+        for ( ; i < count; i++ )
         {
-            Animation work;
-            work.transform = transform;
-            work.curves[0].keys.push_back(transform->m_position.x);
-            work.curves[0].times.push_back(0);
-            work.curves[1].keys.push_back(transform->m_position.y);
-            work.curves[1].times.push_back(0);
-            work.curves[2].keys.push_back(transform->m_position.z);
-            work.curves[2].times.push_back(0);
-            work.curves[3].keys.push_back(transform->m_rotation.x);
-            work.curves[3].times.push_back(0);
-            work.curves[4].keys.push_back(transform->m_rotation.y);
-            work.curves[4].times.push_back(0);
-            work.curves[5].keys.push_back(transform->m_rotation.z);
-            work.curves[5].times.push_back(0);
-            work.curves[6].keys.push_back(transform->m_rotation.w);
-            work.curves[6].times.push_back(0);
-            work.curves[7].keys.push_back(transform->m_scale.x);
-            work.curves[7].times.push_back(0);
-            work.curves[8].keys.push_back(transform->m_scale.y);
-            work.curves[8].times.push_back(0);
-            work.curves[9].keys.push_back(transform->m_scale.z);
-            work.curves[9].times.push_back(0);
-
-            animationList.push_back(work);
+            const auto dot = ( a.value[0][i] * b.value[0][i] + a.value[1][i] * b.value[1][i] ) +
+                ( a.value[2][i] * b.value[2][i] + a.value[3][i] * b.value[3][i] );
+            const auto sign = dot < 0 ? -1.0f : 1.0f;
+            for ( auto c = 0; c < 4; c++ )
+                d[c][i] = a.value[c][i] + ( b.value[c][i] * sign - a.value[c][i] ) * weights[i];
         }
+    }
 
-        for ( auto && child : transform->m_child )
+    //dst = base * nlerp(Pʉ], conjugate(reference) * additive, weight)(K͂Ȃ)
+    static void AddRotations(const Pose& base, const Pose& additive, const Pose& reference, const float weight, Pose& dst)
+    {
+        const Rotations p( base );
+        const Rotations a( additive );
+        const Rotations r( reference );
+        float* d[4] = { dst.GetChannel( 3 ), dst.GetChannel( 4 ), dst.GetChannel( 5 ), dst.GetChannel( 6 ) };
+        const auto count = dst.boneCount;
+        std::size_t i = 0;
+#ifdef UEM_SSE2
+        const auto w = _mm_set1_ps( weight );
+        const auto one = _mm_set1_ps( 1.0f );
+        const auto signBit = _mm_set1_ps( -0.0f );
+        for ( ; i + 4 <= count; i += 4 )
+        {
+            __m128 vp[4], va[4], vr[4], delta[4], result[4];
+            for ( auto c = 0; c < 4; c++ )
+            {
+                vp[c] = _mm_loadu_ps( p.value[c] + i );
+                va[c] = _mm_loadu_ps( a.value[c] + i );
+                vr[c] = _mm_loadu_ps( r.value[c] + i );
+            }
+            for ( auto c = 0; c < 3; c++ )
+                vr[c] = _mm_xor_ps( vr[c], signBit );
+            MultiplyQuaternions( vr, va, delta );
+            //wȂ甽]čŒZoHɂAPʉ]Ԃ
+            const auto sign = _mm_and_ps( delta[3], signBit );
+            for ( auto c = 0; c < 3; c++ )
+                delta[c] = _mm_mul_ps( _mm_xor_ps( delta[c], sign ), w );
+            delta[3] = _mm_add_ps( one, _mm_mul_ps( _mm_sub_ps( _mm_xor_ps( delta[3], sign ), one ), w ) );
+            MultiplyQuaternions( vp, delta, result );
+            for ( auto c = 0; c < 4; c++ )
+                _mm_storeu_ps( d[c] + i, result[c] );
+        }
+#endif
+        for ( ; i < count; i++ )
         {
-            CheckTransform(child);
+            const float conjugate[4] = { -r.value[0][i], -r.value[1][i], -r.value[2][i], r.value[3][i] };
+            const float value[4] = { a.value[0][i], a.value[1][i], a.value[2][i], a.value[3][i] };
+            float delta[4];
+            MultiplyQuaternions( conjugate, value, delta );
+            const auto sign = delta[3] < 0 ? -1.0f : 1.0f;
+            for ( auto c = 0; c < 3; c++ )
+                delta[c] *= sign * weight;
+            delta[3] = 1 + ( delta[3] * sign - 1 ) * weight;
+            const float from[4] = { p.value[0][i], p.value[1][i], p.value[2][i], p.value[3][i] };
+            float result[4];
+            MultiplyQuaternions( from, delta, result );
+            for ( auto c = 0; c < 4; c++ )
+                d[c][i] = result[c];
         }
     }
+
+    //NH[^jI̐a * b(xyzw)
+    static void MultiplyQuaternions(const float* a, const float* b, float* dst)
+    {
+        dst[0] = a[3] * b[0] + a[0] * b[3] + a[1] * b[2] - a[2] * b[1];
+        dst[1] = a[3] * b[1] - a[0] * b[2] + a[1] * b[3] + a[2] * b[0];
+        dst[2] = a[3] * b[2] + a[0] * b[1] - a[1] * b[0] + a[2] * b[3];
+        dst[3] = a[3] * b[3] - a[0] * b[0] - a[1] * b[1] - a[2] * b[2];
+    }
+
+#ifdef UEM_SSE2
+    //4{[a * b(Ƃ̔z)
+    static void MultiplyQuaternions(const __m128* a, const __m128* b, __m128* dst)
+    {
+        dst[0] = _mm_sub_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( a[3], b[0] ), _mm_mul_ps( a[0], b[3] ) ), _mm_mul_ps( a[1], b[2] ) ),
+                             _mm_mul_ps( a[2], b[1] ) );
+        dst[1] = _mm_add_ps( _mm_add_ps( _mm_sub_ps( _mm_mul_ps( a[3], b[1] ), _mm_mul_ps( a[0], b[2] ) ), _mm_mul_ps( a[1], b[3] ) ),
+                             _mm_mul_ps( a[2], b[0] ) );
+        dst[2] = _mm_add_ps( _mm_sub_ps( _mm_add_ps( _mm_mul_ps( a[3], b[2] ), _mm_mul_ps( a[0], b[1] ) ), _mm_mul_ps( a[1], b[0] ) ),
+                             _mm_mul_ps( a[2], b[3] ) );
+        dst[3] = _mm_sub_ps( _mm_sub_ps( _mm_sub_ps( _mm_mul_ps( a[3], b[3] ), _mm_mul_ps( a[0], b[0] ) ), _mm_mul_ps( a[1], b[1] ) ),
+                             _mm_mul_ps( a[2], b[2] ) );
+    }
+
+    //4{[̉]̓
+    static __m128 Dot4(const __m128* a, const __m128* b)
+    {
+        return _mm_add_ps( _mm_add_ps( _mm_mul_ps( a[0], b[0] ), _mm_mul_ps( a[1], b[1] ) ),
+                           _mm_add_ps( _mm_mul_ps( a[2], b[2] ), _mm_mul_ps( a[3], b[3] ) ) );
+    }
+#endif
 };
 }
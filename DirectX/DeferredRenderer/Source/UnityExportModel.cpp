@@ -6,13 +6,11 @@ UnityExportModel::UnityExportModel()
 	ps.Attach(g_DX11Manager.CreatePixelShader("Assets/Shaders/UnityExportModel.hlsl", "psMain"));
 
 	//InputLayout�̍쐬
-	D3D11_INPUT_ELEMENT_DESC elem[] = {
-		{ "POSITION",	0,	DXGI_FORMAT_R32G32B32_FLOAT,	0,	0,	D3D11_INPUT_PER_VERTEX_DATA,	0 },
-		{ "NORMAL"	,	0,	DXGI_FORMAT_R32G32B32_FLOAT,	0,	12,	D3D11_INPUT_PER_VERTEX_DATA,	0 },
-		{ "TEXCOORD",	0,	DXGI_FORMAT_R32G32_FLOAT,		0,	24,	D3D11_INPUT_PER_VERTEX_DATA,	0 },
-		{ "COLOR"	,	0,	DXGI_FORMAT_R32G32B32A32_FLOAT,	0,	32,	D3D11_INPUT_PER_VERTEX_DATA,	0 },
-	};
-	il.Attach(g_DX11Manager.CreateInputLayout(elem, 4, "Assets/Shaders/UnityExportModel.hlsl", "vsMain"));
+	//VertexData::VertexAttributes()から作るので、頂点の型と食い違うことはない
+	il.Attach(g_DX11Manager.CreateInputLayout<VertexData>("Assets/Shaders/UnityExportModel.hlsl", "vsMain"));
+
+	//頂点ストリームに分けたモデル用(位置はスロット0、それ以外はスロット1)
+	splitIl.Attach(g_DX11Manager.CreateInputLayout<VertexData>("Assets/Shaders/UnityExportModel.hlsl", "vsMain", true));
 }
 
 void UnityExportModel::LoadAscii(string filename)
@@ -22,10 +20,7 @@ void UnityExportModel::LoadAscii(string filename)
 	//VertexBuffer IndexBuffer�쐬
 	for (auto& mesh : uemData.m_meshes)
 	{
-		ModelData tmpData;
-		tmpData.vb.Attach(g_DX11Manager.CreateVertexBuffer(mesh.vertexDatas.data(), (UINT)mesh.vertexDatas.size()));
-		tmpData.ib.Attach(g_DX11Manager.CreateIndexBuffer(mesh.indexes.data(), (UINT)mesh.indexes.size()));
-		models.push_back(tmpData);
+		models.push_back(CreateModelData(mesh));
 	}
 
 	//TextureLoad
@@ -44,10 +39,7 @@ void UnityExportModel::LoadBinary(string filename)
 	//VertexBuffer IndexBuffer�쐬
 	for (auto& mesh : uemData.m_meshes)
 	{
-		ModelData tmpData;
-		tmpData.vb.Attach(g_DX11Manager.CreateVertexBuffer(mesh.vertexDatas.data(), (UINT)mesh.vertexDatas.size()));
-		tmpData.ib.Attach(g_DX11Manager.CreateIndexBuffer(mesh.indexes.data(), (UINT)mesh.indexes.size()));
-		models.push_back(tmpData);
+		models.push_back(CreateModelData(mesh));
 	}
 
 	//TextureLoad
@@ -59,17 +51,122 @@ void UnityExportModel::LoadBinary(string filename)
 	}
 }
 
+std::shared_future<void> UnityExportModel::LoadBinaryAsync(string filename)
+{
+	auto pending = std::make_shared<PendingData>();
+	pendingFuture = uem::ThreadPool::GetDefault().Enqueue([pending, filename]()
+	{
+		auto name = filename;
+		pending->uemData.LoadBinary(name);
+		//フォーマットが合わないなどで読み込めなかった場合はUpdateUploadで差し替えずに投げ直す
+		if (pending->uemData.m_meshes.empty())
+			throw std::runtime_error("failed to load " + filename);
+
+		//テクスチャのデコードもワーカースレッドで済ませておく
+		pending->textures.resize(pending->uemData.m_materials.size());
+		for (size_t i = 0; i < pending->textures.size(); i++)
+			g_DX11Manager.LoadTextureImage(pending->uemData.m_materials[i].GetTexture("_MainTex"), pending->textures[i]);
+	}).share();
+	pendingData = pending;
+	pendingModels.clear();
+	pendingMaterials.clear();
+	return pendingFuture;
+}
+
+bool UnityExportModel::UpdateUpload(double budgetMilliseconds)
+{
+	if (!pendingData)
+		return true;
+	if (pendingFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+		return false;
+	try
+	{
+		pendingFuture.get();
+	}
+	catch (...)
+	{
+		//読み込みに失敗したので読み込み前のデータのまま、例外を呼び出し元に投げ直す
+		pendingData.reset();
+		pendingModels.clear();
+		pendingMaterials.clear();
+		throw;
+	}
+
+	//バッファかテクスチャを1つずつ作成し、予算を使い切ったら次のフレームに回す(1フレームに最低1つは進める)
+	const auto start = std::chrono::steady_clock::now();
+	auto& data = pendingData->uemData;
+	do
+	{
+		if (pendingModels.size() < data.m_meshes.size())
+		{
+			auto& mesh = data.m_meshes[pendingModels.size()];
+			pendingModels.push_back(CreateModelData(mesh));
+		}
+		else if (pendingMaterials.size() < pendingData->textures.size())
+		{
+			auto& texture = pendingData->textures[pendingMaterials.size()];
+			Material tmpMaterial;
+			tmpMaterial.albedoTexture.Attach(g_DX11Manager.CreateTextureFromImage(texture));
+			texture.image.reset();
+			pendingMaterials.push_back(tmpMaterial);
+		}
+		else
+		{
+			//全て転送できたので描画に使うデータと差し替える
+			uemData = std::move(data);
+			models = std::move(pendingModels);
+			materials = std::move(pendingMaterials);
+			pendingModels.clear();
+			pendingMaterials.clear();
+			pendingData.reset();
+			return true;
+		}
+	} while (std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() < budgetMilliseconds);
+	return false;
+}
+
+UnityExportModel::ModelData UnityExportModel::CreateModelData(const uem::Model<VertexData>::Mesh& mesh)
+{
+	ModelData tmpData;
+	//頂点ストリームに分けたモデルはストリームごとにバッファを作る
+	if (!mesh.positions.empty())
+	{
+		tmpData.vb.Attach(g_DX11Manager.CreateVertexBuffer(mesh.positions.data(), (UINT)mesh.positions.size()));
+		if (!mesh.attributes.empty())
+			tmpData.attributeVb.Attach(g_DX11Manager.CreateVertexBuffer(mesh.attributes.data(), (UINT)mesh.positions.size(), (UINT)mesh.AttributeStride));
+	}
+	else
+		tmpData.vb.Attach(g_DX11Manager.CreateVertexBuffer(mesh.vertexDatas.data(), (UINT)mesh.vertexDatas.size()));
+	tmpData.ib.Attach(g_DX11Manager.CreateIndexBuffer(mesh.indexes.data(), (UINT)mesh.indexes.size(), (UINT)mesh.indexes.GetStride()));
+	tmpData.indexSize = (UINT)mesh.indexes.GetStride();
+	return tmpData;
+}
+
+bool UnityExportModel::IsLoading() const
+{
+	return pendingData != nullptr;
+}
+
 void UnityExportModel::Draw()
 {
 	g_DX11Manager.SetVertexShader(vs.Get());
 	g_DX11Manager.SetPixelShader(ps.Get());
 
-	g_DX11Manager.SetInputLayout(il.Get());
-
 	for (int i = 0; i < uemData.m_meshes.size();i++) {
 		auto& model = uemData.m_meshes[i];
-		g_DX11Manager.SetVertexBuffer(models[i].vb.Get(), sizeof(VertexData));
-		g_DX11Manager.SetIndexBuffer(models[i].ib.Get());
+		if (models[i].attributeVb.Get() != nullptr)
+		{
+			ID3D11Buffer* vbs[] = { models[i].vb.Get(), models[i].attributeVb.Get() };
+			UINT sizes[] = { sizeof(XMFLOAT3), (UINT)model.AttributeStride };
+			g_DX11Manager.SetInputLayout(splitIl.Get());
+			g_DX11Manager.SetVertexBuffers(2, vbs, sizes);
+		}
+		else
+		{
+			g_DX11Manager.SetInputLayout(il.Get());
+			g_DX11Manager.SetVertexBuffer(models[i].vb.Get(), sizeof(VertexData));
+		}
+		g_DX11Manager.SetIndexBuffer(models[i].ib.Get(), models[i].indexSize);
 		if (materials[model.materialNo].albedoTexture.Get() != nullptr)
 			g_DX11Manager.SetTexture2D(0, materials[model.materialNo].albedoTexture.Get());
 
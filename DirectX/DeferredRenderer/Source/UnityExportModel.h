@@ -4,6 +4,7 @@
 class UnityExportModel
 {
 	InputLayout il;
+	InputLayout splitIl; //_Xg[ɕfp
 	VertexShader vs;
 	PixelShader ps;
 public:
@@ -12,6 +13,16 @@ public:
 		XMFLOAT3 position;
 		XMFLOAT3 normal = XMFLOAT3(0, 0, 0);
 		XMFLOAT2 uv = XMFLOAT2(0, 0);
+
+		//vf̕(̓CAEgƓǂݍݎ̕ϊɎg)
+		static constexpr std::array<uem::VertexAttribute, 3> VertexAttributes()
+		{
+			return { {
+				{ uem::Flg::POSITION,	offsetof(VertexData, position),	sizeof(VertexData::position) },
+				{ uem::Flg::NORMAL,		offsetof(VertexData, normal),	sizeof(VertexData::normal) },
+				{ uem::Flg::UV1,		offsetof(VertexData, uv),		sizeof(VertexData::uv) },
+			} };
+		}
 	};
 
 	struct Material
@@ -21,8 +32,10 @@ public:
 
 	struct ModelData
 	{
-		VertexBuffer vb;
+		VertexBuffer vb; //_Xg[ɕfł͈ʒu
+		VertexBuffer attributeVb; //_Xg[ɕf̈ʒuȊO̗vf
 		IndexBuffer ib;
+		UINT indexSize = sizeof(UINT); //16bitCfbNXȂ2
 	};
 
 	uem::Model<VertexData> uemData;
@@ -35,5 +48,28 @@ public:
 	void LoadAscii(string filename);
 	void LoadBinary(string filename);
 
+	//t@Cǂݍ݁ÉEeNX`̃fR[h[J[Xbhōs
+	//GPUւ̓]UpdateUploadōsASďI_œǂݍݍς݂̃f[^ƍւ
+	std::shared_future<void> LoadBinaryAsync(string filename);
+	//`Xbh疈t[ĂԁBbudgetMillisecondsȓŃobt@ƃeNX`쐬A]SďIĂtrueԂ
+	//[J[Xbhł̓ǂݍ݂sĂꍇ͍ւɂ̗O𓊂
+	bool UpdateUpload(double budgetMilliseconds);
+	bool IsLoading() const;
+
 	void Draw();
+
+private:
+	ModelData CreateModelData(const uem::Model<VertexData>::Mesh& mesh);
+
+	//[J[Xbhō]҂̃f[^
+	struct PendingData
+	{
+		uem::Model<VertexData> uemData;
+		vector<TextureImage> textures;
+	};
+
+	std::shared_ptr<PendingData> pendingData;
+	std::shared_future<void> pendingFuture;
+	vector<ModelData> pendingModels;
+	vector<Material> pendingMaterials;
 };
\ No newline at end of file
@@ -6,14 +6,11 @@ UnityExportSkinnedModel::UnityExportSkinnedModel()
 	ps.Attach(g_DX11Manager.CreatePixelShader("Assets/Shaders/UnityExportSkinnedModel.hlsl", "psMain"));
 
 	//InputLayout̍쐬
-	D3D11_INPUT_ELEMENT_DESC elem[] = {
-		{ "POSITION"	,	0,	DXGI_FORMAT_R32G32B32_FLOAT,	0,	0,	D3D11_INPUT_PER_VERTEX_DATA,	0 },
-		{ "NORMAL"		,	0,	DXGI_FORMAT_R32G32B32_FLOAT,	0,	12,	D3D11_INPUT_PER_VERTEX_DATA,	0 },
-		{ "TEXCOORD"	,	0,	DXGI_FORMAT_R32G32_FLOAT,		0,	24,	D3D11_INPUT_PER_VERTEX_DATA,	0 },
-		{ "BONEINDEX"	,	0,	DXGI_FORMAT_R32G32B32A32_UINT,	0,	32,	D3D11_INPUT_PER_VERTEX_DATA,	0 },
-		{ "BONEWEIGHT"	,	0,	DXGI_FORMAT_R32G32B32A32_FLOAT,	0,	48,	D3D11_INPUT_PER_VERTEX_DATA,	0 },
-	};
-	il.Attach(g_DX11Manager.CreateInputLayout(elem, 5, "Assets/Shaders/UnityExportSkinnedModel.hlsl", "vsMain"));
+	//VertexData::VertexAttributes()̂ŁA_̌^ƐHႤƂ͂Ȃ
+	il.Attach(g_DX11Manager.CreateInputLayout<VertexData>("Assets/Shaders/UnityExportSkinnedModel.hlsl", "vsMain"));
+
+	//_Xg[ɕfp(ʒu̓Xbg0A{[̓Xbg2AȊO̓Xbg1)
+	splitIl.Attach(g_DX11Manager.CreateInputLayout<VertexData>("Assets/Shaders/UnityExportSkinnedModel.hlsl", "vsMain", true));
 
 	g_DX11Manager.CreateConstantBuffer(sizeof(XMMATRIX) * 200, &boneMtxCb);
 
@@ -26,10 +23,7 @@ void UnityExportSkinnedModel::LoadAscii(string filename)
 	//VertexBuffer IndexBuffer쐬
 	for (auto& mesh : uemData.m_meshes)
 	{
-		ModelData tmpData;
-		tmpData.vb.Attach(g_DX11Manager.CreateVertexBuffer(mesh.vertexDatas.data(), (UINT)mesh.vertexDatas.size()));
-		tmpData.ib.Attach(g_DX11Manager.CreateIndexBuffer(mesh.indexes.data(), (UINT)mesh.indexes.size()));
-		models.push_back(tmpData);
+		models.push_back(CreateModelData(mesh));
 	}
 
 	//TextureLoad
@@ -48,10 +42,7 @@ void UnityExportSkinnedModel::LoadBinary(string filename)
 	//VertexBuffer IndexBuffer쐬
 	for (auto& mesh : uemData.m_meshes)
 	{
-		ModelData tmpData;
-		tmpData.vb.Attach(g_DX11Manager.CreateVertexBuffer(mesh.vertexDatas.data(), (UINT)mesh.vertexDatas.size()));
-		tmpData.ib.Attach(g_DX11Manager.CreateIndexBuffer(mesh.indexes.data(), (UINT)mesh.indexes.size()));
-		models.push_back(tmpData);
+		models.push_back(CreateModelData(mesh));
 	}
 
 	//TextureLoad
@@ -63,13 +54,107 @@ void UnityExportSkinnedModel::LoadBinary(string filename)
 	}
 }
 
+std::shared_future<void> UnityExportSkinnedModel::LoadBinaryAsync(string filename)
+{
+	auto pending = std::make_shared<PendingData>();
+	pendingFuture = uem::ThreadPool::GetDefault().Enqueue([pending, filename]()
+	{
+		pending->uemData.LoadBinary(filename);
+		//tH[}bgȂȂǂœǂݍ߂ȂꍇUpdateUploadōւɓ
+		if (pending->uemData.m_meshes.empty())
+			throw std::runtime_error("failed to load " + filename);
+
+		//eNX`̃fR[h[J[Xbhōς܂Ă
+		pending->textures.resize(pending->uemData.m_materials.size());
+		for (size_t i = 0; i < pending->textures.size(); i++)
+			g_DX11Manager.LoadTextureImage(pending->uemData.m_materials[i].GetTexture("_MainTex"), pending->textures[i]);
+	}).share();
+	pendingData = pending;
+	pendingModels.clear();
+	pendingMaterials.clear();
+	return pendingFuture;
+}
+
+bool UnityExportSkinnedModel::UpdateUpload(double budgetMilliseconds)
+{
+	if (!pendingData)
+		return true;
+	if (pendingFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+		return false;
+	try
+	{
+		pendingFuture.get();
+	}
+	catch (...)
+	{
+		//ǂݍ݂ɎŝœǂݍݑÕf[^̂܂܁AOĂяoɓ
+		pendingData.reset();
+		pendingModels.clear();
+		pendingMaterials.clear();
+		throw;
+	}
+
+	//obt@eNX`1쐬A\Zg؂玟̃t[ɉ(1t[ɍŒ1͐i߂)
+	const auto start = std::chrono::steady_clock::now();
+	auto& data = pendingData->uemData;
+	do
+	{
+		if (pendingModels.size() < data.m_meshes.size())
+		{
+			auto& mesh = data.m_meshes[pendingModels.size()];
+			pendingModels.push_back(CreateModelData(mesh));
+		}
+		else if (pendingMaterials.size() < pendingData->textures.size())
+		{
+			auto& texture = pendingData->textures[pendingMaterials.size()];
+			Material tmpMaterial;
+			tmpMaterial.albedoTexture.Attach(g_DX11Manager.CreateTextureFromImage(texture));
+			texture.image.reset();
+			pendingMaterials.push_back(tmpMaterial);
+		}
+		else
+		{
+			//Sē]ł̂ŕ`Ɏgf[^ƍւ
+			uemData = std::move(data);
+			models = std::move(pendingModels);
+			materials = std::move(pendingMaterials);
+			pendingModels.clear();
+			pendingMaterials.clear();
+			pendingData.reset();
+			return true;
+		}
+	} while (std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() < budgetMilliseconds);
+	return false;
+}
+
+UnityExportSkinnedModel::ModelData UnityExportSkinnedModel::CreateModelData(const uem::SkinnedModel<VertexData>::Mesh& mesh)
+{
+	ModelData tmpData;
+	//_Xg[ɕf̓Xg[ƂɃobt@
+	if (!mesh.positions.empty())
+	{
+		tmpData.vb.Attach(g_DX11Manager.CreateVertexBuffer(mesh.positions.data(), (UINT)mesh.positions.size()));
+		if (!mesh.attributes.empty())
+			tmpData.attributeVb.Attach(g_DX11Manager.CreateVertexBuffer(mesh.attributes.data(), (UINT)mesh.positions.size(), (UINT)mesh.AttributeStride));
+		tmpData.skinVb.Attach(g_DX11Manager.CreateVertexBuffer(mesh.skins.data(), (UINT)mesh.skins.size()));
+	}
+	else
+		tmpData.vb.Attach(g_DX11Manager.CreateVertexBuffer(mesh.vertexDatas.data(), (UINT)mesh.vertexDatas.size()));
+	tmpData.ib.Attach(g_DX11Manager.CreateIndexBuffer(mesh.indexes.data(), (UINT)mesh.indexes.size(), (UINT)mesh.indexes.GetStride()));
+	tmpData.indexSize = (UINT)mesh.indexes.GetStride();
+	return tmpData;
+}
+
+bool UnityExportSkinnedModel::IsLoading() const
+{
+	return pendingData != nullptr;
+}
+
 void UnityExportSkinnedModel::Draw()
 {
 	g_DX11Manager.SetVertexShader(vs.Get());
 	g_DX11Manager.SetPixelShader(ps.Get());
 
-	g_DX11Manager.SetInputLayout(il.Get());
-
 	for(int j=0;j<uemData.m_meshes.size();j++){
 		auto& model = uemData.m_meshes[j];
 		//{[s
@@ -82,8 +167,19 @@ void UnityExportSkinnedModel::Draw()
 		ID3D11Buffer* tmpCb[] = { boneMtxCb.Get() };
 		g_DX11Manager.m_pImContext->VSSetConstantBuffers(1, 1, tmpCb);
 
-		g_DX11Manager.SetVertexBuffer(models[j].vb.Get(), sizeof(VertexData));
-		g_DX11Manager.SetIndexBuffer(models[j].ib.Get());
+		if (models[j].skinVb.Get() != nullptr)
+		{
+			ID3D11Buffer* vbs[] = { models[j].vb.Get(), models[j].attributeVb.Get(), models[j].skinVb.Get() };
+			UINT sizes[] = { sizeof(XMFLOAT3), (UINT)model.AttributeStride, sizeof(uem::VertexSkin) };
+			g_DX11Manager.SetInputLayout(splitIl.Get());
+			g_DX11Manager.SetVertexBuffers(3, vbs, sizes);
+		}
+		else
+		{
+			g_DX11Manager.SetInputLayout(il.Get());
+			g_DX11Manager.SetVertexBuffer(models[j].vb.Get(), sizeof(VertexData));
+		}
+		g_DX11Manager.SetIndexBuffer(models[j].ib.Get(), models[j].indexSize);
 		if (materials[model.materialNo].albedoTexture.Get() != nullptr)
 			g_DX11Manager.SetTexture2D(0, materials[model.materialNo].albedoTexture.Get());
 
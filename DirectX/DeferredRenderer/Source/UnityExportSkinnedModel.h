@@ -4,6 +4,7 @@
 class UnityExportSkinnedModel
 {
 	InputLayout il;
+	InputLayout splitIl; //_Xg[ɕfp
 	VertexShader vs;
 	PixelShader ps;
 
@@ -17,6 +18,18 @@ public:
 		XMFLOAT2 uv = XMFLOAT2(0, 0);
 		XMUINT4 boneIndex = XMUINT4(0, 0, 0, 0);
 		XMFLOAT4 boneWeight = XMFLOAT4(0, 0, 0, 0);
+
+		//vf̕(̓CAEgƓǂݍݎ̕ϊɎg)
+		static constexpr std::array<uem::VertexAttribute, 5> VertexAttributes()
+		{
+			return { {
+				{ uem::Flg::POSITION,				offsetof(VertexData, position),		sizeof(VertexData::position) },
+				{ uem::Flg::NORMAL,					offsetof(VertexData, normal),		sizeof(VertexData::normal) },
+				{ uem::Flg::UV1,					offsetof(VertexData, uv),			sizeof(VertexData::uv) },
+				{ uem::VertexLayout::BONE_INDEX,	offsetof(VertexData, boneIndex),	sizeof(VertexData::boneIndex) },
+				{ uem::VertexLayout::BONE_WEIGHT,	offsetof(VertexData, boneWeight),	sizeof(VertexData::boneWeight) },
+			} };
+		}
 	};
 
 	struct Material
@@ -26,8 +39,11 @@ public:
 
 	struct ModelData
 	{
-		VertexBuffer vb;
+		VertexBuffer vb; //_Xg[ɕfł͈ʒu
+		VertexBuffer attributeVb; //_Xg[ɕf̈ʒuƃ{[ȊO̗vf
+		VertexBuffer skinVb; //_Xg[ɕfBoneIndex & BoneWeight
 		IndexBuffer ib;
+		UINT indexSize = sizeof(UINT); //16bitCfbNXȂ2
 	};
 
 	uem::SkinnedModel<VertexData> uemData;
@@ -40,6 +56,29 @@ public:
 	void LoadAscii(string filename);
 	void LoadBinary(string filename);
 
+	//t@Cǂݍ݁ÉEeNX`̃fR[h[J[Xbhōs
+	//GPUւ̓]UpdateUploadōsASďI_œǂݍݍς݂̃f[^ƍւ
+	std::shared_future<void> LoadBinaryAsync(string filename);
+	//`Xbh疈t[ĂԁBbudgetMillisecondsȓŃobt@ƃeNX`쐬A]SďIĂtrueԂ
+	//[J[Xbhł̓ǂݍ݂sĂꍇ͍ւɂ̗O𓊂
+	bool UpdateUpload(double budgetMilliseconds);
+	bool IsLoading() const;
+
 	//void DrawImGui(std::shared_ptr<uem::Transform> trans);
 	void Draw();
+
+private:
+	ModelData CreateModelData(const uem::SkinnedModel<VertexData>::Mesh& mesh);
+
+	//[J[Xbhō]҂̃f[^
+	struct PendingData
+	{
+		uem::SkinnedModel<VertexData> uemData;
+		vector<TextureImage> textures;
+	};
+
+	std::shared_ptr<PendingData> pendingData;
+	std::shared_future<void> pendingFuture;
+	vector<ModelData> pendingModels;
+	vector<Material> pendingMaterials;
 };
\ No newline at end of file
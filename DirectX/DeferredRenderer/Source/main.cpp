@@ -7,8 +7,16 @@ ConstantBuffer cb;
 
 int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _In_ LPSTR lpCmdLine, _In_ int nCmdShow)
 {
+	//eNX`̔񓯊ǂݍ݂Ń[J[XbhWICĝŁAMTAvZX̏I܂ŕێ
+	//(XbhƂɏƉJԂƁADirectXTexLbVWIC̃t@Ng[̉MTAj邱Ƃ)
+	if (FAILED(CoInitializeEx(nullptr, COINIT_MULTITHREADED)))
+		return -1;
+
 	if (FAILED(g_DX11Manager.Init(hInstance, nCmdShow)))
+	{
+		CoUninitialize();
 		return -1;
+	}
 
 	//RX^gobt@̍쐬
 	g_DX11Manager.CreateConstantBuffer(sizeof(ConstantBufferMatrix), &cb);
@@ -24,15 +32,22 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
 
 	UnityExportModel model;
 	//model.LoadAscii("Assets/Models/MeshData.uma");
-	model.LoadBinary("Assets/Models/MeshData.umb");
+	//model.LoadBinary("Assets/Models/MeshData.umb");
+	model.LoadBinaryAsync("Assets/Models/MeshData.umb");
 
 	UnityExportSkinnedModel skinnedModel;
 	//skinnedModel.LoadAscii("Assets/Models/SkinnedMeshData.usa");
-	skinnedModel.LoadBinary("Assets/Models/SkinnedMeshData.usb");
-
-	uem::SkinnedAnimation animation;
-	//animation.LoadAscii("Assets/Models/JUMP00anim.usaa", skinnedModel.uemData.root.get());
-	animation.LoadBinary("Assets/Models/JUMP00anim.usab", skinnedModel.uemData.m_root.get());
+	//skinnedModel.LoadBinary("Assets/Models/SkinnedMeshData.usb");
+	skinnedModel.LoadBinaryAsync("Assets/Models/SkinnedMeshData.usb");
+
+	//Aj[V̓f̊Kw\Ă烏[J[Xbhœǂݍ
+	//WvEEOEEɑNbv
+	std::vector<uem::SkinnedAnimation> animations;
+	std::future<std::vector<uem::SkinnedAnimation>> animationFuture;
+	uem::AnimationBlender blender;
+	uem::AnimationBlender::Pose pose, jumpPose;
+	bool animationLoaded = false;
+	bool skinnedModelFailed = false;
 	MSG msg = { 0 };
 	while (true)
 	{
@@ -64,12 +79,74 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
 		constantBuffer.world = XMMatrixTranspose(XMMatrixIdentity());
 		g_DX11Manager.UpdateConstantBuffer(cb.Get(), constantBuffer);
 
+		//񓯊ǂݍ݂fGPU](1t[2msȓ)
+		//ǂݍ݂Ɏsf͍ւɗRo͂(XLbV̏ꍇ̓Aj[Vǂݍ܂Ȃ)
+		try
+		{
+			model.UpdateUpload(2.0);
+		}
+		catch (const std::exception& e)
+		{
+			OutputDebugStringA(e.what());
+		}
+		bool skinnedModelUploaded = false;
+		try
+		{
+			skinnedModelUploaded = skinnedModel.UpdateUpload(2.0);
+		}
+		catch (const std::exception& e)
+		{
+			OutputDebugStringA(e.what());
+			skinnedModelFailed = true;
+		}
+		if (skinnedModelUploaded && !skinnedModelFailed && !animationLoaded)
+		{
+			//animation.LoadAscii("Assets/Models/JUMP00anim.usaa", skinnedModel.uemData.root.get());
+			auto* root = skinnedModel.uemData.m_root.get();
+			if (!animationFuture.valid())
+			{
+				animationFuture = uem::ThreadPool::GetDefault().Enqueue([root]()
+				{
+					return uem::SkinnedAnimation::LoadBinaryLibrary({ "Assets/Models/JUMP00anim.usab", "Assets/Models/RUN00_Lanim.usab",
+						"Assets/Models/RUN00_Fanim.usab", "Assets/Models/RUN00_Ranim.usab" }, root);
+				});
+			}
+			else if (animationFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+			{
+				//ǂݍ݂It[Ńu_[ɓo^
+				animations = animationFuture.get();
+				blender.Reset(uem::TransformTable(root));
+				for (const auto& animation : animations)
+					blender.AddClip(animation);
+				animationLoaded = true;
+			}
+		}
+
 		//MainLoop
 		g_DX11Manager.DrawBegin();
 
 		static float animeTime = 0.0f;
-		ImGui::SliderFloat("AnimTime", &animeTime, 0.0f, animation.GetMaxAnimationTime());
-		animation.SetTransform(animeTime);
+		static float runTime = 0.0f;
+		static float direction = 0.0f;
+		static float jumpWeight = 1.0f;
+		if (animationLoaded)
+		{
+			ImGui::SliderFloat("AnimTime", &animeTime, 0.0f, animations[0].GetMaxAnimationTime());
+			ImGui::SliderFloat("Direction", &direction, -1.0f, 1.0f);
+			ImGui::SliderFloat("JumpWeight", &jumpWeight, 0.0f, 1.0f);
+			//31D̃uhXy[XōAWv㏑̃C[ŏd˂Ă1񂾂Transformɏ
+			runTime += 1.0f / 60.0f;
+			if (runTime > animations[2].GetMaxAnimationTime())
+				runTime = 0.0f;
+			const float positions[] = { -1.0f, 0.0f, 1.0f };
+			float weights[3];
+			uem::AnimationBlender::GetBlendWeights1D(positions, 3, direction, weights);
+			const uem::AnimationBlender::BlendInput inputs[] = { { 1, runTime, weights[0] }, { 2, runTime, weights[1] }, { 3, runTime, weights[2] } };
+			blender.SampleBlend(inputs, 3, pose);
+			blender.SampleClip(0, animeTime, jumpPose);
+			blender.LerpPose(pose, jumpPose, jumpWeight, pose);
+			blender.ApplyPose(pose);
+		}
 
 		ID3D11Buffer* tmpCb[] = { cb.Get() };
 		g_DX11Manager.m_pImContext->VSSetConstantBuffers(0, 1, tmpCb);
@@ -81,5 +158,6 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
 	}
 
 	g_DX11Manager.Cleanup();
+	CoUninitialize();
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,83 @@
+//AnimationBlender::LerpPoseAddPoseŁAdstɓ͂Ɠpnʂʂ̎pɏ񂾌ʂƈv邩m߂
+//͂̃{[قȂ(dstk߂)ꍇ܂߂
+//
+//rh(VisualStudio̊J҃R}hvvgŁADeferredRenderer̃tH_[):
+//	cl /std:c++17 /O2 /EHsc /I Source Test\PoseLerpAliasing.cpp
+//s:
+//	PoseLerpAliasing.exe
+//sꍇ͗Ro͂1Ԃ
+#include "UniExportModel.hpp"
+#include <cmath>
+#include <cstdio>
+
+using Pose = uem::AnimationBlender::Pose;
+
+//{[ƂɈقȂʒuE](Kl)EXP[p
+static Pose MakePose(const std::size_t boneCount, const float seed)
+{
+	Pose pose;
+	pose.Resize(boneCount);
+	for (std::size_t bone = 0; bone < boneCount; bone++)
+	{
+		const auto angle = seed + 0.3f * bone;
+		const float values[uem::SkinnedAnimation::PoseChannelCount] = {
+			seed + bone, seed - bone, 2.0f * bone,
+			std::sin(angle) * 0.6f, std::cos(angle) * 0.6f, 0.0f, 0.8f,
+			1.0f + 0.1f * bone, 1.0f, 1.0f + seed };
+		for (auto channel = 0; channel < uem::SkinnedAnimation::PoseChannelCount; channel++)
+			pose.GetChannel(channel)[bone] = values[channel];
+	}
+	return pose;
+}
+
+static bool Equal(const Pose& expected, const Pose& actual, const char* message)
+{
+	if (expected.boneCount != actual.boneCount)
+	{
+		std::printf("failed: %s bone count %zu != %zu\n", message, actual.boneCount, expected.boneCount);
+		return false;
+	}
+	for (std::size_t i = 0; i < expected.channels.size() && i < actual.channels.size(); i++)
+	{
+		if (std::fabs(expected.channels[i] - actual.channels[i]) > 1e-6f)
+		{
+			std::printf("failed: %s channel %zu bone %zu\n", message, i / expected.boneCount, i % expected.boneCount);
+			return false;
+		}
+	}
+	return true;
+}
+
+int main()
+{
+	uem::AnimationBlender blender;
+	bool succeeded = true;
+	//(from̃{[, tõ{[): AfromAto
+	const std::size_t counts[][2] = { { 5, 5 }, { 7, 4 }, { 3, 6 } };
+	for (const auto& count : counts)
+	{
+		const auto from = MakePose(count[0], 0.5f);
+		const auto to = MakePose(count[1], -1.25f);
+
+		Pose expected;
+		blender.LerpPose(from, to, 0.3f, expected);
+
+		auto aliasFrom = from;
+		blender.LerpPose(aliasFrom, to, 0.3f, aliasFrom);
+		succeeded &= Equal(expected, aliasFrom, "LerpPose dst == from");
+
+		auto aliasTo = to;
+		blender.LerpPose(from, aliasTo, 0.3f, aliasTo);
+		succeeded &= Equal(expected, aliasTo, "LerpPose dst == to");
+
+		Pose expectedAdd;
+		const auto reference = MakePose(count[1], 2.0f);
+		uem::AnimationBlender::AddPose(from, to, reference, 0.7f, expectedAdd);
+
+		auto aliasBase = from;
+		uem::AnimationBlender::AddPose(aliasBase, to, reference, 0.7f, aliasBase);
+		succeeded &= Equal(expectedAdd, aliasBase, "AddPose dst == base");
+	}
+	std::printf(succeeded ? "ok\n" : "failed\n");
+	return succeeded ? 0 : 1;
+}
@@ -0,0 +1,107 @@
+//_Xg[ɕRei`̃t@CA_tH[}bgƈقȂvfLqť^ɕϊēǂݍ߂邩m߂
+//̃XLbVʒuȆ̗vfEBoneIndex & BoneWeight̃Xg[ɕĕϊA
+//t@CƓт̌^œǂݍ񂾌ʂƁANORMALȂ^ɕϊēǂݍ񂾌ʂׂ
+//
+//rh(VisualStudio̊J҃R}hvvgŁADeferredRenderer̃tH_[):
+//	cl /std:c++17 /O2 /EHsc /I Source Test\SplitStreamConversion.cpp
+//s(DeferredRenderer̃tH_[Aϊt@C̓JgtH_[ɈꎞIɏo):
+//	SplitStreamConversion.exe
+//sꍇ͗Ro͂1Ԃ
+#include "UniExportModel.hpp"
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+//TṽXLbVƓ_CAEg(t@C̕тƈv̂Œ_Xg[̂܂ܓǂݍ)
+struct VertexData
+{
+	DirectX::XMFLOAT3 position;
+	DirectX::XMFLOAT3 normal;
+	DirectX::XMFLOAT2 uv;
+	DirectX::XMUINT4 boneIndex;
+	DirectX::XMFLOAT4 boneWeight;
+};
+
+//NORMALAтt@CƈقȂ钸_CAEg(ǂݍݎɗvfƂɕϊ)
+struct NoNormalVertex
+{
+	DirectX::XMFLOAT2 uv;
+	DirectX::XMFLOAT3 position;
+	DirectX::XMFLOAT4 boneWeight;
+	DirectX::XMUINT4 boneIndex;
+
+	static constexpr std::array<uem::VertexAttribute, 4> VertexAttributes()
+	{
+		return { {
+			{ uem::Flg::UV1,					offsetof(NoNormalVertex, uv),			sizeof(NoNormalVertex::uv) },
+			{ uem::Flg::POSITION,				offsetof(NoNormalVertex, position),		sizeof(NoNormalVertex::position) },
+			{ uem::VertexLayout::BONE_WEIGHT,	offsetof(NoNormalVertex, boneWeight),	sizeof(NoNormalVertex::boneWeight) },
+			{ uem::VertexLayout::BONE_INDEX,	offsetof(NoNormalVertex, boneIndex),	sizeof(NoNormalVertex::boneIndex) },
+		} };
+	}
+};
+
+static bool Check(const bool condition, const char* message)
+{
+	if (!condition)
+		std::printf("failed: %s\n", message);
+	return condition;
+}
+
+//_Xg[̂܂ܓǂݍ񂾃bVƁAϊēǂݍ񂾃bV̗vfׂ
+static bool Compare(const uem::SkinnedModel<VertexData>& expected, const uem::SkinnedModel<NoNormalVertex>& actual)
+{
+	if (!Check(expected.m_meshes.size() == actual.m_meshes.size() && !actual.m_meshes.empty(), "mesh count"))
+		return false;
+	constexpr auto uvOffset = sizeof(DirectX::XMFLOAT3); //attributes̒UV̈ʒu(NORMAĽ)
+	for (std::size_t i = 0; i < expected.m_meshes.size(); i++)
+	{
+		const auto& src = expected.m_meshes[i];
+		const auto& dst = actual.m_meshes[i];
+		if (!Check(!src.positions.empty() && src.vertexDatas.empty(), "reference mesh is not split") ||
+			!Check(dst.positions.empty() && dst.attributes.empty() && dst.skins.empty(), "converted mesh still has streams") ||
+			!Check(dst.vertexDatas.size() == src.positions.size(), "vertex count") ||
+			!Check(dst.GetVertexCount() == src.GetVertexCount(), "GetVertexCount") ||
+			!Check(dst.indexes.size() == src.indexes.size(), "index count"))
+			return false;
+		for (std::size_t j = 0; j < src.positions.size(); j++)
+		{
+			const auto& vertex = dst.vertexDatas[j];
+			const auto* attributes = src.attributes.data() + uem::SkinnedModel<VertexData>::Mesh::AttributeStride * j;
+			if (!Check(std::memcmp(&vertex.position, &src.positions[j], sizeof(vertex.position)) == 0, "position") ||
+				!Check(std::memcmp(&vertex.uv, attributes + uvOffset, sizeof(vertex.uv)) == 0, "uv") ||
+				!Check(std::memcmp(&vertex.boneIndex, &src.skins[j].boneIndex, sizeof(vertex.boneIndex)) == 0, "bone index") ||
+				!Check(std::memcmp(&vertex.boneWeight, &src.skins[j].boneWeight, sizeof(vertex.boneWeight)) == 0, "bone weight"))
+				return false;
+		}
+	}
+	return true;
+}
+
+int main()
+{
+	const std::string source = "Assets/Models/SkinnedMeshData.usb";
+	bool succeeded = true;
+	//kƁAubNk(ǂݍ݂œWJ)
+	for (const auto compress : { 0, static_cast<int>(uem::CompressFlg::BLOCKS) })
+	{
+		const std::string split = "./SplitStreamConversion.usb"; //LoadBinary̓tH_[؂/Kv
+		if (!Check(uem::UpgradeBinaryFile(source, split, uem::ContainerKind::SkinnedModel, 0, compress, true), "UpgradeBinaryFile"))
+			return 1;
+
+		uem::SkinnedModel<VertexData> expected;
+		expected.LoadBinary(split);
+
+		uem::SkinnedModel<NoNormalVertex> sequential;
+		sequential.LoadBinary(split);
+		succeeded &= Compare(expected, sequential);
+
+		uem::SkinnedModel<NoNormalVertex> parallel;
+		parallel.LoadBinaryParallel(split);
+		succeeded &= Compare(expected, parallel);
+
+		std::remove(split.c_str());
+	}
+	std::printf(succeeded ? "ok\n" : "failed\n");
+	return succeeded ? 0 : 1;
+}
@@ -214,6 +214,7 @@ namespace Editor
             var gameObjectMeshes = CombineMesh(meshObjectList);
             
             writer.Write((ushort)gameObjectMeshes.Count);
+            var meshOffsets = new List<long>();
             foreach (var gameObjectMesh in gameObjectMeshes)
             {
                 //ProgressView
@@ -222,12 +223,14 @@ namespace Editor
                 var baseProgressStr = gameObjectMesh.Item1.name + "...(" + matchIndex + "/" + meshObjectList.Count + ")";
                 EditorUtility.DisplayProgressBar("Write", progressStr = baseProgressStr, progress);
                 
+                meshOffsets.Add(writer.BaseStream.Position);
                 gameObjectMesh.Item2.OutputBinary(writer, vertexDataOption);
 
                 //マテリアルデータを出力
                 gameObjectMesh.Item1.GetComponent<MeshRenderer>().sharedMaterial.OutputBinary(writer,materialDataOption,filePath);
             }
 
+            writer.WriteMeshOffsetTable(meshOffsets);
             EditorUtility.ClearProgressBar();
         }
     }
@@ -353,11 +353,13 @@ namespace Editor
 			writer.Write((short) vertexFormat);
 
 			writer.Write((ushort) (smrs.Length + mrs.Length));
+			var meshOffsets = new List<long>();
 			foreach (var smr in smrs)
 			{
 				var mesh = smr.sharedMesh;
 
 				//頂点データ出力
+				meshOffsets.Add(writer.BaseStream.Position);
 				var skinnedMesh = new SkinnedMesh(mesh);
 				skinnedMesh.OutputBinary(writer, vertexDataOption);
 
@@ -435,6 +437,7 @@ namespace Editor
 				var mesh = mr.GetComponent<MeshFilter>().sharedMesh;
 
 				//頂点データ出力
+				meshOffsets.Add(writer.BaseStream.Position);
 				var skinnedMesh = new SkinnedMesh(mesh);
 				skinnedMesh.OutputBinary(writer, vertexDataOption);
 
@@ -468,6 +471,8 @@ namespace Editor
 				//マテリアルデータの出力
 				mr.sharedMaterial.OutputBinary(writer, materialDataOption, filePath);
 			}
+
+			writer.WriteMeshOffsetTable(meshOffsets);
 		}
 
 		//TODO Next Version...
@@ -583,6 +583,18 @@ public class SkinnedMesh
 
 public static class ExtensionClass
 {
+    //メッシュオフセットテーブルをファイル末尾に出力(C++側でメッシュを並列に読み込むために使う)
+    public static void WriteMeshOffsetTable([NotNull] this BinaryWriter writer, List<long> offsets)
+    {
+        foreach (var offset in offsets)
+        {
+            writer.Write((ulong) offset);
+        }
+
+        writer.Write((uint) offsets.Count);
+        writer.Write(0x544F4D55u); //"UMOT"
+    }
+
     public static void OutputAscii(this Material material, [NotNull] TextWriter writer, MaterialDataOption option,
                                    string        filepath)
     {